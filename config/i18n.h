@@ -1,23 +1,127 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 #include <fstream>
 #include <sstream>
 #include <filesystem>
 #include <iostream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
 
 // Simple header-only i18n loader.
 // - Loads all *.lang files found in a `locales/` subdirectory next to the executable (working dir).
 // - Each `.lang` file: `key=value` lines. Lines starting with `#` or blank lines are ignored.
 // - Consumers can call get(code, key) to obtain the localized string. If not found, falls back to EN.
 // - Use placeholder `{SAVE_FILENAME}` in language files; caller may substitute runtime values.
+// - Loading is lazy and single-pass: the first lookup (or reload()) discovers every locale
+//   folder once, parses each file once, and can reuse parsed files from a cache (cachePath).
+// - Lookups go through FlatLocales: every locale flattened into one table with fallbacks applied.
+// - A compiled bundle (bundlePath, see writeBundle) replaces discovery: it is mapped
+//   into memory and served as-is, so no .lang file is listed or parsed.
+// - watch() applies edits to .lang files (or a rebuilt bundle) while the program runs.
+
+// FlatLocales: immutable, flattened form of all loaded locales.
+// Keys are sorted and shared by all locales; every locale is one row of
+// keys.size() entries that already include the EN / LANGFALLBACK fallback.
+// Texts are interned (identical strings stored once) in a single arena, and
+// keys are found through an open-addressing hash index (one probe, usually).
+struct FlatLocales {
+    static constexpr std::uint32_t kMissing = 0xFFFFFFFFu;
+    static constexpr std::uint32_t kInherited = 0x80000000u;  // entry resolved through the fallback chain
+    static constexpr std::size_t npos = (std::size_t)-1;
+
+    std::string arena;                      // key and text bytes; the views below point into it
+    std::shared_ptr<const void> mapping;    // or: the mapped bundle they point into (arena unused)
+    std::size_t mappedBytes = 0;
+    std::vector<std::string_view> keys;     // sorted
+    std::vector<std::string_view> texts;    // distinct texts
+    std::vector<std::string> codes;         // uppercase, sorted
+    std::vector<std::uint32_t> entries;     // row-major: codes.size() x keys.size(), text index | kInherited
+    std::vector<std::uint32_t> slots;       // hash index into keys (power of two, kMissing = empty)
+    std::size_t defaultRow = npos;          // row for unknown codes: EN, else LANGFALLBACK
+
+    static std::uint32_t hashKey(std::string_view s) {
+        std::uint32_t h = 2166136261u;
+        for (unsigned char c : s) { h ^= c; h *= 16777619u; }
+        return h;
+    }
+
+    // Build `slots` from `keys` (load factor <= 1/2)
+    void indexKeys() {
+        std::size_t n = 8;
+        while (n < keys.size() * 2) n <<= 1;
+        slots.assign(n, kMissing);
+        for (std::uint32_t k = 0; k < keys.size(); ++k) {
+            std::size_t i = hashKey(keys[k]) & (n - 1);
+            while (slots[i] != kMissing) i = (i + 1) & (n - 1);
+            slots[i] = k;
+        }
+    }
+
+    // Row of a language code (case-insensitive), npos if not loaded
+    std::size_t row(std::string_view code) const {
+        for (std::size_t r = 0; r < codes.size(); ++r) {
+            const std::string &c = codes[r];
+            if (c.size() != code.size()) continue;
+            std::size_t i = 0;   // codes are ASCII; avoid locale-aware toupper on this path
+            while (i < c.size() && c[i] == ((code[i] >= 'a' && code[i] <= 'z') ? (char)(code[i] - 'a' + 'A') : code[i])) ++i;
+            if (i == c.size()) return r;
+        }
+        return npos;
+    }
+
+    std::size_t key(std::string_view id) const {
+        if (slots.empty()) return npos;
+        const std::size_t mask = slots.size() - 1;
+        for (std::size_t i = hashKey(id) & mask; slots[i] != kMissing; i = (i + 1) & mask) {
+            if (keys[slots[i]] == id) return slots[i];
+        }
+        return npos;
+    }
+
+    // Text of an entry; empty if no locale has it. *native: the row's own text, not a fallback.
+    std::string_view text(std::size_t r, std::size_t k, bool *native = nullptr) const {
+        std::uint32_t e = entries[r * keys.size() + k];
+        if (native) *native = e != kMissing && !(e & kInherited);
+        return e == kMissing ? std::string_view() : texts[e & ~kInherited];
+    }
+
+    // Text for (code, id) with the fallback chain applied; unknown codes use defaultRow
+    std::string_view lookup(std::string_view code, std::string_view id, bool *native = nullptr) const {
+        if (native) *native = false;
+        std::size_t k = key(id);
+        if (k == npos) return std::string_view();
+        std::size_t r = row(code);
+        if (r != npos) return text(r, k, native);
+        return defaultRow == npos ? std::string_view() : text(defaultRow, k);
+    }
+};
 
 class I18n {
 public:
     using LocaleMap = std::unordered_map<std::string, std::string>;
-    std::unordered_map<std::string, LocaleMap> locales; // code -> (id -> text)
+    std::unordered_map<std::string, LocaleMap> locales; // code -> (id -> text); merge staging, lookups use FlatLocales
     std::string fallback = "EN";
 
     // Name of the deliberate fallback language file. Create a file named
@@ -27,6 +131,12 @@ public:
     // Diagnostics captured while loading locales for later querying (useful for --list-locales).
     std::vector<std::string> loadDiagnostics;
 
+    // Bumped after each new table is published (a locale committed, reload(), or
+    // a watched file changed). Callers caching rendered text compare it to decide
+    // when to re-render; read it before taking flatLocales() so a table published
+    // in between is picked up on the next check.
+    std::atomic<unsigned long> generation{0};
+
     // Essential keys that we require a locale to provide to be considered valid.
     // If a locale is missing any of these (or they are empty) we'll reject that locale
     // at load-time so a bad/misplaced file (e.g., from a random game) can't overwrite UI.
@@ -43,49 +153,125 @@ public:
         return missing.empty();
     }
 
-    std::vector<std::string> getLoadDiagnostics() const { return loadDiagnostics; }
+    std::vector<std::string> getLoadDiagnostics() const {
+        ensureLoaded();
+        std::lock_guard<std::mutex> g(loadMutex);
+        return loadDiagnostics;
+    }
 
-    I18n() {
-        // Primary: try working directory / local run folder
-        tryLoadLocalesFolder("locales");
+    // Optional parse cache: files whose path, size and mtime match are not re-read.
+    // Empty disables it.
+    std::string cachePath;
 
-        // Also try relative to header / project tree (helpful when working dir is different)
-        try {
-            std::filesystem::path headerDir = std::filesystem::path(__FILE__).parent_path();
-            tryLoadLocalesFolder((headerDir / "locales").string());
-            // also try parent of header (project root) in case locales are placed there
-            tryLoadLocalesFolder((headerDir.parent_path() / "locales").string());
-            // also try config/locales from working directory
-            tryLoadLocalesFolder("config/locales");
-            // also try absolute path to config/locales (robust against different working dirs)
-            try {
-                std::filesystem::path absConfigPath = std::filesystem::absolute(headerDir / "locales");
-                tryLoadLocalesFolder(absConfigPath.string());
-            } catch (...) { /* ignore */ }
-        } catch (...) { /* ignore */ }
+    // Optional compiled bundle (see writeBundle). When it exists and is valid,
+    // discovery maps it instead of scanning, so edits to .lang files show up
+    // only after the bundle is rebuilt or deleted. Empty disables it.
+    std::string bundlePath;
 
-        if (locales.empty()) {
-            // Helpful diagnostic so user knows why keys may show up as IDs
-            std::cerr << "Warning: no locale files loaded (looked in working dir and project). UI keys will be shown instead of translations.\n";
-        }
+    // Extra folders scanned before localeRoots() (lowest precedence), e.g. the
+    // machine-translated samples when compiling a bundle.
+    std::vector<std::filesystem::path> extraRoots;
+
+    // Number of .lang files merged by the last discovery (0 when served from a bundle)
+    std::size_t localeFileCount = 0;
+
+    // Languages needed right away (e.g. the one in the save file). When set,
+    // discovery merges only these, EN and LANGFALLBACK; the other files are
+    // merged by the first call that needs them (availableLanguages, a lookup
+    // in another language, see ensureComplete).
+    std::vector<std::string> primaryCodes;
+
+    // Nothing is scanned until the first lookup or reload(), so a program that
+    // changes its working directory first pays for discovery only once.
+    I18n() = default;
+    ~I18n() { unwatch(); }
+
+    // Run discovery if it has not happened yet (lookups call this; cheap afterwards)
+    void ensureLoaded() const {
+        if (loaded.load(std::memory_order_acquire)) return;
+        std::lock_guard<std::mutex> g(loadMutex);
+        if (!loaded.load(std::memory_order_relaxed)) const_cast<I18n *>(this)->discover();
+    }
+
+    // Merge the languages a primaryCodes discovery left out (no-op otherwise)
+    void ensureComplete() const {
+        ensureLoaded();
+        if (!partial.load(std::memory_order_acquire)) return;
+        std::lock_guard<std::mutex> g(loadMutex);
+        if (!partial.load(std::memory_order_relaxed)) return;
+        auto *self = const_cast<I18n *>(this);
+        self->completed = true;
+        self->discover();
+    }
+
+    // Make sure `code` is loaded if it exists at all
+    void ensureLanguage(std::string_view code) const {
+        ensureLoaded();
+        if (!partial.load(std::memory_order_acquire)) return;
+        const FlatLocales *f = flatRaw.load(std::memory_order_acquire);
+        if (!f || f->row(code) == FlatLocales::npos) ensureComplete();
     }
 
     // Reload locales (useful if working directory changed after initialization)
     void reload() {
-        locales.clear();
-        loadDiagnostics.clear();
-        // Re-run the same loading sequence as constructor
-        tryLoadLocalesFolder("locales");
+        std::lock_guard<std::mutex> g(loadMutex);
+        discover();
+    }
+
+    // Locale roots in increasing precedence: ./locales, then the project's
+    // config/locales (relative to this header or the working directory).
+    // Canonicalized and deduplicated, so each folder is scanned once.
+    std::vector<std::filesystem::path> localeRoots() const {
+        std::vector<std::filesystem::path> candidates = extraRoots;
+        candidates.push_back("locales");
         try {
             std::filesystem::path headerDir = std::filesystem::path(__FILE__).parent_path();
-            tryLoadLocalesFolder((headerDir / "locales").string());
-            tryLoadLocalesFolder((headerDir.parent_path() / "locales").string());
-            tryLoadLocalesFolder("config/locales");
-            try {
-                std::filesystem::path absConfigPath = std::filesystem::absolute(headerDir / "locales");
-                tryLoadLocalesFolder(absConfigPath.string());
-            } catch (...) { /* ignore */ }
+            candidates.push_back(headerDir / "locales");
+            // also try parent of header (project root) in case locales are placed there
+            candidates.push_back(headerDir.parent_path() / "locales");
+            candidates.push_back("config/locales");
         } catch (...) { /* ignore */ }
+        std::vector<std::filesystem::path> roots;
+        for (auto &c : candidates) {
+            std::error_code ec;
+            if (!std::filesystem::is_directory(c, ec)) continue;
+            auto canon = std::filesystem::canonical(c, ec);
+            if (!ec && std::find(roots.begin(), roots.end(), canon) == roots.end()) roots.push_back(canon);
+        }
+        return roots;
+    }
+
+    // Merge order within a folder: base files (en.lang) before extras (EN_extra.lang)
+    static bool localeFileOrder(const std::filesystem::path &a, const std::filesystem::path &b) {
+        bool ea = a.stem().string().find('_') != std::string::npos;
+        bool eb = b.stem().string().find('_') != std::string::npos;
+        return ea != eb ? eb : a < b;
+    }
+
+    // Locale files under a root in merge order: packs in nested folders first,
+    // then the root's own files, which therefore win on conflicting keys.
+    static std::vector<std::filesystem::path> localeFilesUnder(const std::filesystem::path &root) {
+        auto listDir = [](const std::filesystem::path &dir, std::vector<std::filesystem::path> &out) {
+            std::vector<std::filesystem::path> files;
+            std::error_code ec;
+            for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+                std::error_code fec;
+                if (it->is_regular_file(fec) && it->path().extension() == ".lang") files.push_back(it->path());
+            }
+            std::sort(files.begin(), files.end(), localeFileOrder);
+            out.insert(out.end(), files.begin(), files.end());
+        };
+        std::vector<std::filesystem::path> subdirs, out;
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator it(root, std::filesystem::directory_options::skip_permission_denied, ec), end;
+             !ec && it != end; it.increment(ec)) {
+            std::error_code dec;
+            if (it->is_directory(dec)) subdirs.push_back(it->path());
+        }
+        std::sort(subdirs.begin(), subdirs.end());
+        for (auto &d : subdirs) listDir(d, out);
+        listDir(root, out);
+        return out;
     }
 
     static inline std::string trim(const std::string &s) {
@@ -108,18 +294,20 @@ public:
         return out;
     }
 
-    bool loadLocaleFile(const std::string &path) {
-        std::filesystem::path p(path);
-        if (!std::filesystem::exists(p)) return false;
+    // Language code for a locale file: stem up to the first '_', uppercased
+    // (EN_extra.lang and en.lang both belong to EN).
+    static std::string localeCodeForFile(const std::filesystem::path &p) {
         std::string code = p.stem().string();
-        // If file is named like EN_extra.lang, treat it as EN (merge extras)
         auto underscorePos = code.find('_');
         if (underscorePos != std::string::npos) code = code.substr(0, underscorePos);
-        // uppercase code for consistency
         for (auto &c : code) c = (char)toupper((unsigned char)c);
+        return code;
+    }
+
+    // Parse `key=value` lines of one file into map (later keys overwrite earlier ones)
+    static bool parseLocaleFile(const std::string &path, LocaleMap &map) {
         std::ifstream ifs(path);
         if (!ifs.good()) return false;
-        LocaleMap map;
         std::string line;
         while (std::getline(ifs, line)) {
             std::string tline = trim(line);
@@ -128,9 +316,21 @@ public:
             if (pos == std::string::npos) continue;
             std::string k = trim(tline.substr(0, pos));
             std::string v = trim(tline.substr(pos + 1));
-            v = unescape(v);
-            map[k] = v;
+            map[k] = unescape(v);
         }
+        return true;
+    }
+
+    bool loadLocaleFile(const std::string &path) {
+        ensureLoaded();
+        std::lock_guard<std::mutex> g(loadMutex);
+        stageBundle();
+        std::filesystem::path p(path);
+        if (!std::filesystem::exists(p)) return false;
+        // If file is named like EN_extra.lang, treat it as EN (merge extras)
+        std::string code = localeCodeForFile(p);
+        LocaleMap map;
+        if (!parseLocaleFile(path, map)) return false;
 
         // Merge map with existing values in a temporary buffer so we can validate the
         // resulting locale without mutating the stored one if validation fails.
@@ -153,11 +353,15 @@ public:
 
         // OK - commit merged locale
         locales[code] = std::move(merged);
+        publishFlat();
         std::cerr << "i18n: loaded '" << code << "' from " << path << "\n";
         return true;
     }
 
 void tryLoadLocalesFolder(const std::string &folder) {
+    ensureLoaded();
+    std::lock_guard<std::mutex> g(loadMutex);
+    stageBundle();
     std::filesystem::path p(folder);
     if (!std::filesystem::exists(p) || !std::filesystem::is_directory(p)) return;
 
@@ -167,11 +371,7 @@ void tryLoadLocalesFolder(const std::string &folder) {
         try {
             if (!entry.is_regular_file()) continue;
             if (entry.path().extension() != ".lang") continue;
-            std::string stem = entry.path().stem().string();
-            auto underscorePos = stem.find('_');
-            if (underscorePos != std::string::npos) stem = stem.substr(0, underscorePos);
-            for (auto &c : stem) c = (char)toupper((unsigned char)c);
-            filesByCode[stem].push_back(entry.path().string());
+            filesByCode[localeCodeForFile(entry.path())].push_back(entry.path().string());
         } catch (...) { /* ignore */ }
     }
 
@@ -185,19 +385,7 @@ void tryLoadLocalesFolder(const std::string &folder) {
 
         for (auto &fp : kv.second) {
             try {
-                std::ifstream ifs(fp);
-                if (!ifs.good()) continue;
-                std::string line;
-                while (std::getline(ifs, line)) {
-                    std::string tline = trim(line);
-                    if (tline.empty() || tline[0] == '#') continue;
-                    auto pos = tline.find('=');
-                    if (pos == std::string::npos) continue;
-                    std::string k = trim(tline.substr(0, pos));
-                    std::string v = trim(tline.substr(pos + 1));
-                    v = unescape(v);
-                    merged[k] = v;
-                }
+                parseLocaleFile(fp, merged);
             } catch (...) { /* ignore file read errors */ }
         }
 
@@ -215,6 +403,7 @@ void tryLoadLocalesFolder(const std::string &folder) {
 
         // Commit merged locale
         locales[code] = std::move(merged);
+        publishFlat();
         for (auto &fp : kv.second) {
             std::ostringstream oss;
             oss << "i18n: loaded '" << code << "' from " << fp;
@@ -225,41 +414,700 @@ void tryLoadLocalesFolder(const std::string &folder) {
     }
 }
 
+    // Text for (code, id): requested locale, then EN, then LANGFALLBACK, resolved at
+    // load time. Empty if no locale has it. *native is true only for the requested
+    // locale's own text. Views stay valid for at least kRetireGrace after the table
+    // is replaced; to keep them longer (or to see one consistent table across many
+    // lookups) hold flatLocales() and look up in it instead.
+    std::string_view lookup(std::string_view code, std::string_view id, bool *native = nullptr) const {
+        ensureLanguage(code);
+        const FlatLocales *f = flatRaw.load(std::memory_order_acquire);
+        if (!f) { if (native) *native = false; return std::string_view(); }
+        return f->lookup(code, id, native);
+    }
+
     std::string get(const std::string &code, const std::string &id) const {
-        std::string c = code;
-        for (auto &ch : c) ch = (char)toupper((unsigned char)ch);
-        // 1) Try requested locale (if present and non-empty)
-        auto it = locales.find(c);
-        if (it != locales.end()) {
-            auto it2 = it->second.find(id);
-            if (it2 != it->second.end() && !it2->second.empty()) return it2->second;
-        }
-        // 2) Try configured fallback (EN)
-        auto fit = locales.find(fallback);
-        if (fit != locales.end()) {
-            auto it2 = fit->second.find(id);
-            if (it2 != fit->second.end() && !it2->second.empty()) return it2->second;
-        }
-        // 3) Try the deliberate LangFallback file if present
-        auto ff = locales.find(fallbackFileCode);
-        if (ff != locales.end()) {
-            auto it2 = ff->second.find(id);
-            if (it2 != ff->second.end() && !it2->second.empty()) return it2->second;
-        }
-        // Nothing found
-        return std::string();
+        return std::string(lookup(code, id));
+    }
+
+    // Current flattened tables (for diagnostics such as --locale-stats)
+    std::shared_ptr<const FlatLocales> flatLocales() const {
+        ensureLoaded();
+        std::lock_guard<std::mutex> g(flatMutex);
+        return flat;
     }
 
     std::vector<std::pair<std::string,std::string>> availableLanguages() const {
+        ensureComplete();
         std::vector<std::pair<std::string,std::string>> out;
-        for (auto &p : locales) {
-            std::string name = p.first;
-            auto itn = p.second.find("LANGUAGE_NAME");
-            if (itn != p.second.end()) name = itn->second;
-            out.emplace_back(p.first, name);
+        auto f = flatLocales();
+        if (!f) return out;
+        std::size_t nameKey = f->key("LANGUAGE_NAME");
+        for (std::size_t r = 0; r < f->codes.size(); ++r) {
+            bool native = false;
+            std::string_view name = nameKey == FlatLocales::npos ? std::string_view() : f->text(r, nameKey, &native);
+            out.emplace_back(f->codes[r], native ? std::string(name) : f->codes[r]);
         }
         return out;
     }
+
+    // Bundle layout (native byte order, all u32): "FINBND1\n", kBundleOrder,
+    // locale count, key count, text count, slot count, default row, source file
+    // count, pool size; then (offset, length) pairs into the pool for codes, keys
+    // and texts; the key hash slots; the row-major entries; then the string pool.
+    // Written to a temporary file and renamed, so processes that still have the
+    // old bundle mapped keep reading intact data.
+    static bool writeBundle(const FlatLocales &f, const std::string &path, std::uint32_t sourceFiles, std::string &err) {
+        std::vector<std::uint32_t> head = {kBundleOrder, (std::uint32_t)f.codes.size(), (std::uint32_t)f.keys.size(),
+                                           (std::uint32_t)f.texts.size(), (std::uint32_t)f.slots.size(),
+                                           f.defaultRow == FlatLocales::npos ? FlatLocales::kMissing : (std::uint32_t)f.defaultRow,
+                                           sourceFiles, 0};
+        std::string pool;
+        std::vector<std::uint32_t> spans;
+        auto add = [&](std::string_view sv) {
+            spans.push_back((std::uint32_t)pool.size());
+            spans.push_back((std::uint32_t)sv.size());
+            pool.append(sv.data(), sv.size());
+        };
+        for (auto &c : f.codes) add(c);
+        for (auto &k : f.keys) add(k);
+        for (auto &t : f.texts) add(t);
+        head.back() = (std::uint32_t)pool.size();
+
+        std::string buf(kBundleMagic, 8);
+        auto put = [&](const std::vector<std::uint32_t> &v) { buf.append((const char *)v.data(), v.size() * sizeof(std::uint32_t)); };
+        put(head);
+        put(spans);
+        put(f.slots);
+        put(f.entries);
+        buf += pool;
+
+        std::error_code ec;
+        std::filesystem::path p(path);
+        if (!p.parent_path().empty()) std::filesystem::create_directories(p.parent_path(), ec);
+        const std::string tmp = path + ".tmp";
+        {
+            std::ofstream ofs(tmp, std::ios::out | std::ios::trunc | std::ios::binary);
+            if (!ofs || !ofs.write(buf.data(), (std::streamsize)buf.size())) { err = "cannot write " + tmp; return false; }
+        }
+        std::filesystem::rename(tmp, path, ec);
+        if (ec) { std::filesystem::remove(tmp, ec); err = "cannot replace " + path + ": " + ec.message(); return false; }
+        return true;
+    }
+
+    // Watch the locale folders (and the bundle, if any) from a background thread
+    // and apply changes while the program runs. Only the edited file is
+    // re-parsed and only its language is re-merged and re-validated; the new
+    // table is swapped in whole, so a render that holds flatLocales() never sees
+    // a half-applied edit. An edit that leaves a language invalid keeps its
+    // previous text. While a bundle is served, .lang edits are ignored and a
+    // rebuilt or deleted bundle triggers a full reload. Linux (inotify) only;
+    // false if watching is unavailable.
+    bool watch() {
+#ifdef __linux__
+        ensureLoaded();
+        std::lock_guard<std::mutex> g(watchMutex);
+        if (watcher.joinable()) return true;
+        int fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0) return false;
+        if (::pipe(wakePipe) != 0) { ::close(fd); return false; }
+        inotifyFd = fd;
+        {
+            std::lock_guard<std::mutex> lg(loadMutex);
+            if (!bundlePath.empty()) {
+                std::filesystem::path dir = std::filesystem::path(bundlePath).parent_path();
+                addWatch(dir.empty() ? std::filesystem::path(".") : dir, false);
+            }
+            for (auto &root : localeRoots()) addWatchTree(root);
+        }
+        watcher = std::thread([this] { watchLoop(); });
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void unwatch() {
+#ifdef __linux__
+        std::lock_guard<std::mutex> g(watchMutex);
+        if (!watcher.joinable()) return;
+        char c = 0;
+        if (::write(wakePipe[1], &c, 1) < 0) { /* loop also exits on close below */ }
+        watcher.join();
+        ::close(inotifyFd);
+        ::close(wakePipe[0]);
+        ::close(wakePipe[1]);
+        inotifyFd = -1;
+        watchDirs.clear();
+#endif
+    }
+
+private:
+    mutable std::mutex loadMutex;
+    std::atomic<bool> loaded{false};
+    std::atomic<bool> partial{false};   // last discovery honoured primaryCodes and skipped files
+    bool completed = false;             // ensureComplete ran: primaryCodes no longer apply
+
+    // Parsed pairs of every merged file, per code in merge order, so a watched
+    // edit re-parses one file and re-merges the rest from memory. Requires loadMutex.
+    struct HeldFile {
+        std::string path;
+        std::vector<std::pair<std::string, std::string>> pairs;
+    };
+    std::map<std::string, std::vector<HeldFile>> parsedByCode;
+
+    std::mutex watchMutex;
+    std::thread watcher;
+    int inotifyFd = -1;
+    int wakePipe[2] = {-1, -1};
+    struct WatchedDir {
+        std::filesystem::path path;
+        bool locales = true;   // false: only watched for the bundle
+    };
+    std::map<int, WatchedDir> watchDirs;   // inotify watch descriptor -> folder
+    // Editors write a file in several steps; changes are applied once the folder
+    // has been quiet this long.
+    static constexpr int kSettleMs = 100;
+
+#ifdef __linux__
+    void addWatch(const std::filesystem::path &dir, bool locales = true) {
+        int wd = ::inotify_add_watch(inotifyFd, dir.c_str(),
+                                     IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ONLYDIR);
+        if (wd >= 0) watchDirs[wd] = {dir, locales};   // same folder twice: same wd, last call wins
+    }
+
+    void addWatchTree(const std::filesystem::path &root) {
+        addWatch(root);
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator it(root, std::filesystem::directory_options::skip_permission_denied, ec), end;
+             !ec && it != end; it.increment(ec)) {
+            std::error_code dec;
+            if (it->is_directory(dec)) addWatch(it->path());
+        }
+    }
+
+    void watchLoop() {
+        alignas(inotify_event) char buf[8192];
+        std::set<std::string> changed;   // .lang files touched since the last apply
+        bool rescan = false;             // folders appeared or vanished, or events were lost
+        bool bundleChanged = false;
+        const std::string bundleName = std::filesystem::path(bundlePath).filename().string();
+        for (;;) {
+            pollfd fds[2] = {{inotifyFd, POLLIN, 0}, {wakePipe[0], POLLIN, 0}};
+            const bool pending = !changed.empty() || rescan || bundleChanged;
+            int n = ::poll(fds, 2, pending ? kSettleMs : -1);
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 || fds[1].revents) return;
+            if (n == 0) {
+                applyWatched(changed, rescan, bundleChanged);
+                changed.clear();
+                rescan = bundleChanged = false;
+                continue;
+            }
+            ssize_t len;
+            while ((len = ::read(inotifyFd, buf, sizeof buf)) > 0) {
+                for (char *p = buf; p < buf + len; p += sizeof(inotify_event) + ((inotify_event *)p)->len) {
+                    const inotify_event *ev = (const inotify_event *)p;
+                    if (ev->mask & IN_Q_OVERFLOW) { rescan = true; continue; }
+                    if (ev->mask & IN_IGNORED) { watchDirs.erase(ev->wd); continue; }
+                    auto dir = watchDirs.find(ev->wd);
+                    if (dir == watchDirs.end() || ev->len == 0) continue;
+                    const std::filesystem::path path = dir->second.path / ev->name;
+                    if (!bundleName.empty() && ev->name == bundleName && path == std::filesystem::path(bundlePath)) {
+                        if (!(ev->mask & IN_CREATE)) bundleChanged = true;   // wait for the write to finish
+                    } else if (!dir->second.locales) {
+                        continue;
+                    } else if (ev->mask & IN_ISDIR) {
+                        if (ev->mask & (IN_CREATE | IN_MOVED_TO)) addWatchTree(path);
+                        rescan = true;
+                    } else if (path.extension() == ".lang" && !(ev->mask & IN_CREATE)) {
+                        changed.insert(path.string());
+                    }
+                }
+            }
+        }
+    }
+
+    void applyWatched(const std::set<std::string> &changed, bool rescan, bool bundleChanged) {
+        std::lock_guard<std::mutex> g(loadMutex);
+        if (bundleChanged || (rescan && !servingBundle)) {
+            discover();
+            return;
+        }
+        if (servingBundle) {
+            for (auto &p : changed) {
+                std::string msg = "i18n: " + p + " changed, but locales come from " + bundlePath + "; re-run --compile-locales";
+                std::cerr << msg << "\n";
+                loadDiagnostics.push_back(msg);
+            }
+            return;
+        }
+        std::set<std::string> codes;
+        for (auto &p : changed) codes.insert(localeCodeForFile(p));
+        bool dirty = false;
+        for (auto &code : codes) dirty |= refreshCode(code, changed);
+        if (dirty) publishFlat();
+    }
+#endif
+
+    // Re-merge one language after some of its files changed: changed files are
+    // re-parsed, the others reuse parsedByCode. Returns true if `locales` changed.
+    // Requires loadMutex.
+    bool refreshCode(const std::string &code, const std::set<std::string> &changed) {
+        std::map<std::string, std::vector<std::pair<std::string, std::string>> *> held;
+        for (auto &h : parsedByCode[code]) held[h.path] = &h.pairs;
+        std::vector<HeldFile> files;
+        std::vector<std::string> reparsed;
+        for (auto &root : localeRoots()) {
+            for (auto &file : localeFilesUnder(root)) {
+                if (localeCodeForFile(file) != code) continue;
+                HeldFile h;
+                h.path = file.string();
+                auto it = held.find(h.path);
+                if (it != held.end() && !changed.count(h.path)) {
+                    h.pairs = std::move(*it->second);
+                } else {
+                    LocaleMap map;
+                    try {
+                        if (!parseLocaleFile(h.path, map)) continue;
+                    } catch (...) { continue; }
+                    h.pairs.assign(std::make_move_iterator(map.begin()), std::make_move_iterator(map.end()));
+                    reparsed.push_back(h.path);
+                }
+                files.push_back(std::move(h));
+            }
+        }
+        parsedByCode[code] = std::move(files);
+        const auto &now = parsedByCode[code];
+
+        std::string msg;
+        bool changedLocales = false;
+        if (now.empty()) {
+            changedLocales = locales.erase(code) > 0;
+            msg = "i18n: removed '" + code + "' (no locale files left)";
+        } else {
+            LocaleMap merged;
+            for (auto &h : now) for (auto &kv : h.pairs) merged[kv.first] = kv.second;
+            std::vector<std::string> missing;
+            if (!isLocaleValid(merged, missing)) {
+                msg = "i18n: kept previous '" + code + "' - edited files leave it missing keys:";
+                for (size_t i = 0; i < missing.size(); ++i) msg += (i ? ", " : " ") + missing[i];
+            } else {
+                locales[code] = std::move(merged);
+                changedLocales = true;
+                msg = "i18n: reloaded '" + code + "' (";
+                for (size_t i = 0; i < reparsed.size(); ++i) msg += (i ? ", " : "") + reparsed[i];
+                msg += reparsed.empty() ? "file removed)" : ")";
+            }
+        }
+        std::cerr << msg << "\n";
+        loadDiagnostics.push_back(msg);
+        return changedLocales;
+    }
+
+    // Lookups read flatRaw without locking. Replaced tables are kept in
+    // `retired` for kRetireGrace so views handed out just before a swap stay
+    // valid, and after that until the last flatLocales() holder lets go.
+    static constexpr std::chrono::seconds kRetireGrace{30};
+    struct Retired {
+        std::shared_ptr<const FlatLocales> table;
+        std::chrono::steady_clock::time_point since;
+    };
+    mutable std::mutex flatMutex;
+    std::shared_ptr<const FlatLocales> flat;
+    std::vector<Retired> retired;
+    std::atomic<const FlatLocales *> flatRaw{nullptr};
+
+    // Set while lookups are served from the bundle and `locales` is still empty
+    bool servingBundle = false;
+
+    // Flatten `locales` and publish the result for lookups
+    void publishFlat() { publish(flatten()); }
+
+    void publish(std::shared_ptr<const FlatLocales> next) {
+        std::lock_guard<std::mutex> g(flatMutex);
+        const auto now = std::chrono::steady_clock::now();
+        retired.erase(std::remove_if(retired.begin(), retired.end(), [&](const Retired &r) {
+            return r.table.use_count() == 1 && now - r.since > kRetireGrace;
+        }), retired.end());
+        if (flat) retired.push_back({flat, now});
+        flat = next;
+        flatRaw.store(next.get(), std::memory_order_release);
+        generation.fetch_add(1, std::memory_order_release);
+    }
+
+    std::shared_ptr<const FlatLocales> flatten() const {
+        auto f = std::make_shared<FlatLocales>();
+        std::vector<std::string_view> keys;
+        for (auto &l : locales) {
+            f->codes.push_back(l.first);
+            for (auto &kv : l.second) keys.push_back(kv.first);
+        }
+        std::sort(f->codes.begin(), f->codes.end());
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        auto native = [&](const std::string &code, std::string_view key) -> const std::string * {
+            auto it = locales.find(code);
+            if (it == locales.end()) return nullptr;
+            auto v = it->second.find(std::string(key));
+            return (v == it->second.end() || v->second.empty()) ? nullptr : &v->second;
+        };
+        // Resolve every entry and intern its text (views into `locales` until the arena exists)
+        std::unordered_map<std::string_view, std::uint32_t> interned;
+        std::vector<std::string_view> pending;
+        f->entries.assign(f->codes.size() * keys.size(), FlatLocales::kMissing);
+        for (std::size_t r = 0; r < f->codes.size(); ++r) {
+            for (std::size_t k = 0; k < keys.size(); ++k) {
+                std::uint32_t inherited = 0;
+                const std::string *v = native(f->codes[r], keys[k]);
+                if (!v) { inherited = FlatLocales::kInherited; v = native(fallback, keys[k]); }
+                if (!v) v = native(fallbackFileCode, keys[k]);
+                if (!v) continue;
+                auto ins = interned.emplace(*v, (std::uint32_t)pending.size());
+                if (ins.second) pending.push_back(*v);
+                f->entries[r * keys.size() + k] = ins.first->second | inherited;
+            }
+        }
+
+        std::size_t bytes = 0;
+        for (auto &k : keys) bytes += k.size();
+        for (auto &t : pending) bytes += t.size();
+        f->arena.reserve(bytes);   // no reallocation below, so the views stay valid
+        auto place = [&](std::string_view sv) {
+            std::size_t at = f->arena.size();
+            f->arena.append(sv.data(), sv.size());
+            return std::string_view(f->arena.data() + at, sv.size());
+        };
+        for (auto &k : keys) f->keys.push_back(place(k));
+        for (auto &t : pending) f->texts.push_back(place(t));
+        f->indexKeys();
+
+        for (const std::string *code : {&fallback, &fallbackFileCode}) {
+            if (f->defaultRow != FlatLocales::npos) break;
+            auto it = std::lower_bound(f->codes.begin(), f->codes.end(), *code);
+            if (it != f->codes.end() && *it == *code) f->defaultRow = (std::size_t)(it - f->codes.begin());
+        }
+        return f;
+    }
+
+    static constexpr const char *kBundleMagic = "FINBND1\n";
+    static constexpr std::uint32_t kBundleOrder = 0x01020304u;   // reads differently on the other byte order
+
+    // Read-only mapping of a whole file; null if missing or empty
+    static std::shared_ptr<const void> mapFile(const std::string &path, std::size_t &size) {
+#ifndef _WIN32
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return nullptr;
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) { ::close(fd); return nullptr; }
+        size = (std::size_t)st.st_size;
+        void *p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) return nullptr;
+        return std::shared_ptr<const void>(p, [n = size](const void *q) { ::munmap(const_cast<void *>(q), n); });
+#else
+        std::ifstream ifs(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!ifs || ifs.tellg() <= 0) return nullptr;
+        auto buf = std::make_shared<std::string>((std::size_t)ifs.tellg(), '\0');
+        ifs.seekg(0);
+        if (!ifs.read(&(*buf)[0], (std::streamsize)buf->size())) return nullptr;
+        size = buf->size();
+        return std::shared_ptr<const void>(buf, buf->data());
+#endif
+    }
+
+    // Tables over a mapped bundle: views point into the mapping, nothing is
+    // parsed. Null with `err` set if the file is truncated or inconsistent.
+    static std::shared_ptr<const FlatLocales> openBundle(std::shared_ptr<const void> map, std::size_t size,
+                                                         std::uint32_t &sourceFiles, std::string &err) {
+        const char *base = (const char *)map.get();
+        const std::size_t headWords = 8;
+        if (size < 8 + headWords * 4 || std::memcmp(base, kBundleMagic, 8) != 0) { err = "not a locale bundle"; return nullptr; }
+        std::uint32_t head[headWords];
+        std::memcpy(head, base + 8, sizeof head);
+        if (head[0] != kBundleOrder) { err = "bundle was written on a different byte order"; return nullptr; }
+        const std::uint64_t codes = head[1], keys = head[2], texts = head[3], slots = head[4], poolSize = head[7];
+        const std::uint64_t spanWords = 2 * (codes + keys + texts);
+        const std::uint64_t tableBytes = 8 + (headWords + spanWords + slots + codes * keys) * 4;
+        if (tableBytes + poolSize != size || slots < keys || (slots & (slots - 1)) != 0) { err = "bundle size does not match its header"; return nullptr; }
+        const std::uint32_t *words = (const std::uint32_t *)(base + 8 + headWords * 4);   // mmap is page aligned
+        const char *pool = base + tableBytes;
+
+        auto f = std::make_shared<FlatLocales>();
+        const std::uint32_t *span = words;
+        auto view = [&](std::string_view &out) {
+            std::uint32_t off = *span++, len = *span++;
+            if ((std::uint64_t)off + len > poolSize) return false;
+            out = std::string_view(pool + off, len);
+            return true;
+        };
+        std::string_view sv;
+        for (std::uint64_t i = 0; i < codes; ++i) { if (!view(sv)) { err = "bad code offset"; return nullptr; } f->codes.emplace_back(sv); }
+        f->keys.resize(keys);
+        for (auto &k : f->keys) if (!view(k)) { err = "bad key offset"; return nullptr; }
+        f->texts.resize(texts);
+        for (auto &t : f->texts) if (!view(t)) { err = "bad text offset"; return nullptr; }
+        f->slots.assign(span, span + slots);
+        f->entries.assign(span + slots, span + slots + codes * keys);
+        for (auto k : f->slots) if (k != FlatLocales::kMissing && k >= keys) { err = "bad key slot"; return nullptr; }
+        for (auto e : f->entries) if (e != FlatLocales::kMissing && (e & ~FlatLocales::kInherited) >= texts) { err = "bad text index"; return nullptr; }
+        if (head[5] != FlatLocales::kMissing) {
+            if (head[5] >= codes) { err = "bad default locale"; return nullptr; }
+            f->defaultRow = head[5];
+        }
+        sourceFiles = head[6];
+        f->mapping = std::move(map);
+        f->mappedBytes = size;
+        return f;
+    }
+
+    // Map bundlePath and publish it; false (falling back to discovery) if it is missing or unusable
+    bool loadBundle() {
+        if (bundlePath.empty()) return false;
+        std::size_t size = 0;
+        auto map = mapFile(bundlePath, size);
+        if (!map) return false;
+        std::uint32_t sourceFiles = 0;
+        std::string err;
+        auto f = openBundle(std::move(map), size, sourceFiles, err);
+        if (!f) {
+            std::string msg = "i18n: ignored bundle " + bundlePath + " (" + err + "), scanning locale files";
+            std::cerr << msg << "\n";
+            loadDiagnostics.push_back(msg);
+            return false;
+        }
+        std::string msg = "i18n: loaded " + std::to_string(f->codes.size()) + " locale(s) from bundle " + bundlePath
+                          + " (" + std::to_string(size) + " bytes, compiled from " + std::to_string(sourceFiles) + " file(s))";
+        std::cerr << msg << "\n";
+        loadDiagnostics.push_back(msg);
+        publish(std::move(f));
+        servingBundle = true;
+        return true;
+    }
+
+    // Before merging more files on top of a bundle, copy each locale's own
+    // texts from it into `locales` (the bundle does not keep the maps)
+    void stageBundle() {
+        if (!servingBundle) return;
+        servingBundle = false;
+        auto f = flatLocales();
+        for (std::size_t r = 0; r < f->codes.size(); ++r) {
+            LocaleMap &m = locales[f->codes[r]];
+            for (std::size_t k = 0; k < f->keys.size(); ++k) {
+                bool native = false;
+                std::string_view t = f->text(r, k, &native);
+                if (native) m.emplace(std::string(f->keys[k]), std::string(t));
+            }
+        }
+    }
+
+    // One parsed file as kept in the cache
+    struct ParsedFile {
+        std::uint64_t size = 0;
+        std::int64_t mtime = 0;
+        std::vector<std::pair<std::string, std::string>> pairs;
+    };
+
+    // Cache layout: "FINLOC1\n", u32 file count, then per file: path, u64 size,
+    // i64 mtime, u32 pair count, key/value pairs; strings are u32 length + bytes.
+    static constexpr const char *kCacheMagic = "FINLOC1\n";
+
+    bool readCache(std::unordered_map<std::string, ParsedFile> &out) const {
+        std::ifstream ifs(cachePath, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!ifs) return false;
+        std::string buf((size_t)ifs.tellg(), '\0');
+        ifs.seekg(0);
+        if (!ifs.read(&buf[0], (std::streamsize)buf.size())) return false;
+        size_t pos = 0;
+        auto take = [&](void *dst, size_t n) {
+            if (buf.size() - pos < n) return false;
+            std::memcpy(dst, buf.data() + pos, n);
+            pos += n;
+            return true;
+        };
+        auto takeStr = [&](std::string &str) {
+            std::uint32_t n = 0;
+            if (!take(&n, sizeof n) || buf.size() - pos < n) return false;
+            str.assign(buf, pos, n);
+            pos += n;
+            return true;
+        };
+        const size_t magicLen = std::strlen(kCacheMagic);
+        if (buf.compare(0, magicLen, kCacheMagic) != 0) return false;
+        pos = magicLen;
+        std::uint32_t files = 0;
+        if (!take(&files, sizeof files)) return false;
+        for (std::uint32_t f = 0; f < files; ++f) {
+            std::string path;
+            ParsedFile pf;
+            std::uint32_t pairs = 0;
+            if (!takeStr(path) || !take(&pf.size, sizeof pf.size) || !take(&pf.mtime, sizeof pf.mtime) || !take(&pairs, sizeof pairs)) {
+                out.clear();
+                return false;
+            }
+            pf.pairs.resize(pairs);
+            for (auto &kv : pf.pairs) {
+                if (!takeStr(kv.first) || !takeStr(kv.second)) { out.clear(); return false; }
+            }
+            out.emplace(std::move(path), std::move(pf));
+        }
+        return true;
+    }
+
+    void writeCache(const std::map<std::string, ParsedFile> &files) const {
+        std::string buf = kCacheMagic;
+        auto put = [&](const void *src, size_t n) { buf.append((const char *)src, n); };
+        auto putStr = [&](const std::string &str) {
+            std::uint32_t n = (std::uint32_t)str.size();
+            put(&n, sizeof n);
+            buf += str;
+        };
+        std::uint32_t count = (std::uint32_t)files.size();
+        put(&count, sizeof count);
+        for (auto &f : files) {
+            putStr(f.first);
+            put(&f.second.size, sizeof f.second.size);
+            put(&f.second.mtime, sizeof f.second.mtime);
+            std::uint32_t pairs = (std::uint32_t)f.second.pairs.size();
+            put(&pairs, sizeof pairs);
+            for (auto &kv : f.second.pairs) { putStr(kv.first); putStr(kv.second); }
+        }
+        std::error_code ec;
+        std::filesystem::path p(cachePath);
+        if (!p.parent_path().empty()) std::filesystem::create_directories(p.parent_path(), ec);
+        const std::string tmp = cachePath + ".tmp";
+        {
+            std::ofstream ofs(tmp, std::ios::out | std::ios::trunc | std::ios::binary);
+            if (!ofs || !ofs.write(buf.data(), (std::streamsize)buf.size())) return;
+        }
+        std::filesystem::rename(tmp, cachePath, ec);
+        if (ec) std::filesystem::remove(tmp, ec);
+    }
+
+    // Single pass over every locale file (see localeRoots/localeFilesUnder):
+    // files are merged per code in precedence order and each merged locale is
+    // validated once; with primaryCodes set, only files of those languages are
+    // read. Requires loadMutex.
+    void discover() {
+        locales.clear();
+        loadDiagnostics.clear();
+        localeFileCount = 0;
+        servingBundle = false;
+        parsedByCode.clear();
+        partial.store(false, std::memory_order_release);
+        if (loadBundle()) {
+            loaded.store(true, std::memory_order_release);
+            return;
+        }
+
+        std::unordered_map<std::string, ParsedFile> cache;
+        if (!cachePath.empty()) readCache(cache);
+
+        // Languages merged now; empty means all of them
+        std::set<std::string> wanted;
+        if (!completed && !primaryCodes.empty()) {
+            for (std::string code : primaryCodes) {
+                for (auto &c : code) c = (char)toupper((unsigned char)c);
+                wanted.insert(code);
+            }
+            wanted.insert("EN");
+            wanted.insert("LANGFALLBACK");
+        }
+
+        // Pass 1: list and stat every file; only changed files are parsed
+        struct Found { std::filesystem::path file; std::string path; ParsedFile data; bool fromCache = false; };
+        std::vector<Found> found;
+        std::map<std::string, size_t> byPath;
+        std::vector<std::string> skipped;   // files of languages left for ensureComplete
+        size_t parsed = 0, reused = 0;
+        for (auto &root : localeRoots()) {
+            for (auto &file : localeFilesUnder(root)) {
+                Found f;
+                f.file = file;
+                f.path = file.string();
+                if (byPath.count(f.path)) continue;
+                if (!wanted.empty() && !wanted.count(localeCodeForFile(file))) { skipped.push_back(f.path); continue; }
+                std::error_code ec;
+                f.data.size = (std::uint64_t)std::filesystem::file_size(file, ec);
+                if (ec) continue;
+                auto mtime = std::filesystem::last_write_time(file, ec);
+                if (ec) continue;
+                f.data.mtime = (std::int64_t)mtime.time_since_epoch().count();
+                auto hit = cache.find(f.path);
+                if (hit != cache.end() && hit->second.size == f.data.size && hit->second.mtime == f.data.mtime) {
+                    f.data.pairs = std::move(hit->second.pairs);
+                    f.fromCache = true;
+                    ++reused;
+                } else {
+                    LocaleMap map;
+                    try {
+                        if (!parseLocaleFile(f.path, map)) continue;
+                    } catch (...) { continue; /* ignore file read errors */ }
+                    f.data.pairs.assign(std::make_move_iterator(map.begin()), std::make_move_iterator(map.end()));
+                    ++parsed;
+                }
+                byPath[f.path] = found.size();
+                found.push_back(std::move(f));
+            }
+        }
+        // Entries of skipped files are kept, so a partial pass does not evict them
+        const bool rewriteCache = !cachePath.empty() && (parsed > 0 || (skipped.empty() && reused != cache.size()));
+        if (rewriteCache) {
+            std::map<std::string, ParsedFile> next;
+            for (auto &f : found) next.emplace(f.path, f.data);
+            for (auto &path : skipped) {
+                auto hit = cache.find(path);
+                if (hit != cache.end()) next.emplace(path, std::move(hit->second));
+            }
+            writeCache(next);
+        }
+
+        // Pass 2: merge per code in precedence order (later files win)
+        std::map<std::string, LocaleMap> merged;                 // code -> merged keys
+        std::map<std::string, std::vector<std::string>> sources; // code -> files, in merge order
+        for (auto &f : found) {
+            const std::string code = localeCodeForFile(f.file);
+            LocaleMap &m = merged[code];
+            m.reserve(m.size() + f.data.pairs.size());
+            for (auto &kv : f.data.pairs) m[kv.first] = kv.second;
+            sources[code].push_back(f.path);
+            parsedByCode[code].push_back({f.path, std::move(f.data.pairs)});   // kept for watch()
+        }
+
+        for (auto &kv : merged) {
+            const std::string &code = kv.first;
+            const auto &files = sources[code];
+            // Validate merged locale using required keys
+            std::vector<std::string> missing;
+            if (!isLocaleValid(kv.second, missing)) {
+                std::ostringstream oss;
+                oss << "i18n: skipped '" << code << "' from " << files.front() << " - missing keys:";
+                for (size_t i = 0; i < missing.size(); ++i) oss << (i ? ", " : " ") << missing[i];
+                std::cerr << oss.str() << "\n";
+                loadDiagnostics.push_back(oss.str());
+                continue; // skip this code entirely
+            }
+            locales[code] = std::move(kv.second);
+            for (auto &fp : files) {
+                std::string msg = "i18n: loaded '" + code + "' from " + fp;
+                std::cerr << msg << "\n";
+                loadDiagnostics.push_back(msg);
+            }
+        }
+        localeFileCount = found.size();
+        loadDiagnostics.push_back("i18n: " + std::to_string(found.size()) + " locale file(s): " + std::to_string(parsed)
+                                  + " parsed, " + std::to_string(reused) + " from cache"
+                                  + (skipped.empty() ? std::string() : ", " + std::to_string(skipped.size()) + " deferred"));
+        publishFlat();
+        partial.store(!skipped.empty(), std::memory_order_release);
+        loaded.store(true, std::memory_order_release);
+
+        if (locales.empty()) {
+            // Helpful diagnostic so user knows why keys may show up as IDs
+            std::cerr << "Warning: no locale files loaded (looked in working dir and project). UI keys will be shown instead of translations.\n";
+        }
+    }
 };
 
 // Single global instance convenient for small programs
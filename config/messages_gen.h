@@ -0,0 +1,980 @@
+// Generated by `finance --gen-catalog` from config/locales/*.lang - do not edit.
+// Edit the .lang files and regenerate instead.
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+enum class Msg : unsigned short {
+    Choice,
+    LANGUAGE_NAME,
+    added,
+    added_auto_allocated,
+    alloc_intro,
+    alloc_note,
+    alloc_prompt_current_percent,
+    alloc_remaining,
+    allocations_updated,
+    annual,
+    auto_allocate_note,
+    auto_process_changed,
+    auto_processing_done,
+    auto_processing_start,
+    auto_save_changed,
+    available_languages,
+    cannot_open_load,
+    categories_created,
+    category_list_more,
+    category_missing_prompt,
+    category_not_found_ignored,
+    category_search_hint,
+    category_setup_defaults,
+    category_setup_header,
+    category_setup_prompt,
+    choice,
+    choose_language_prompt,
+    choose_setup_or_retry,
+    current_marker,
+    did_you_mean,
+    enter_numbers_to_remove,
+    existing_categories,
+    exiting_program,
+    external_reloaded,
+    external_rows_merged,
+    external_settings_merged,
+    goodbye,
+    guide_1,
+    guide_10,
+    guide_11,
+    guide_2,
+    guide_3,
+    guide_4,
+    guide_5,
+    guide_6,
+    guide_7,
+    guide_8,
+    guide_9,
+    guide_H,
+    guide_return,
+    interest_applied,
+    interest_entries,
+    interest_menu,
+    interest_processing,
+    interest_removed_for,
+    interest_set_for,
+    interval_must_positive,
+    invalid_alloc_sum,
+    invalid_amount,
+    invalid_choice,
+    invalid_choice_m_or_a,
+    invalid_date_format,
+    invalid_input,
+    invalid_input_extra,
+    invalid_negative_percent,
+    invalid_number,
+    invalid_percent_over,
+    invalid_rate_input,
+    label_auto_process,
+    label_auto_save,
+    label_language,
+    language_set,
+    load_up_to_date,
+    menu_1,
+    menu_10,
+    menu_11,
+    menu_2,
+    menu_3,
+    menu_4,
+    menu_5,
+    menu_6,
+    menu_7,
+    menu_8,
+    menu_9,
+    menu_H,
+    menu_title,
+    monthly,
+    monthly_or_annual_prompt,
+    no_categories_entered,
+    no_categories_selected,
+    no_category_matches,
+    no_interest_entries,
+    no_save_file,
+    no_selection_made,
+    no_valid_categories_selected,
+    nuke_cancel,
+    nuke_confirm,
+    nuke_desc,
+    nuke_done,
+    number_out_of_range,
+    off,
+    on,
+    please_answer_c_or_r,
+    please_answer_s_or_r,
+    press_enter,
+    processed_schedules,
+    prompt_amount,
+    prompt_amount_recurring,
+    prompt_category,
+    prompt_category_info,
+    prompt_category_name,
+    prompt_date,
+    prompt_day_of_month,
+    prompt_interest_categories,
+    prompt_interest_rate,
+    prompt_interval_days,
+    prompt_note,
+    prompt_setup_alloc,
+    quick_entry_added,
+    quick_entry_confirm_partial,
+    quick_entry_intro,
+    quick_entry_line_error,
+    quick_entry_nothing_added,
+    retrying_load,
+    save_file_removed,
+    saved_and_exiting,
+    saved_exit_prompt,
+    saved_to,
+    saving_in_background,
+    schedule_type_prompt,
+    scheduled_added,
+    selection_out_of_range,
+    setup_alloc_later,
+    setup_complete,
+    starting_guide_title,
+    still_no_save,
+    tui_add,
+    tui_add_prompt,
+    tui_col_alloc,
+    tui_col_amount,
+    tui_col_balance,
+    tui_col_category,
+    tui_col_date,
+    tui_col_note,
+    tui_interest_count,
+    tui_keys,
+    tui_process,
+    tui_processed,
+    tui_quit,
+    tui_save,
+    tui_schedule,
+    tui_schedule_count,
+    tui_schedule_prompt,
+    tui_summary,
+    tui_total_balance,
+    tui_transactions,
+    tui_tx_count,
+    unknown_option,
+};
+
+constexpr std::size_t kMsgCount = 158;
+constexpr std::size_t kCatalogLangCount = 4;
+constexpr std::size_t kCatalogFallbackLang = 1;
+
+// Message keys, sorted; kMsgIds[(size_t)Msg::x] == "x"
+constexpr std::string_view kMsgIds[kMsgCount] = {
+    "Choice",
+    "LANGUAGE_NAME",
+    "added",
+    "added_auto_allocated",
+    "alloc_intro",
+    "alloc_note",
+    "alloc_prompt_current_percent",
+    "alloc_remaining",
+    "allocations_updated",
+    "annual",
+    "auto_allocate_note",
+    "auto_process_changed",
+    "auto_processing_done",
+    "auto_processing_start",
+    "auto_save_changed",
+    "available_languages",
+    "cannot_open_load",
+    "categories_created",
+    "category_list_more",
+    "category_missing_prompt",
+    "category_not_found_ignored",
+    "category_search_hint",
+    "category_setup_defaults",
+    "category_setup_header",
+    "category_setup_prompt",
+    "choice",
+    "choose_language_prompt",
+    "choose_setup_or_retry",
+    "current_marker",
+    "did_you_mean",
+    "enter_numbers_to_remove",
+    "existing_categories",
+    "exiting_program",
+    "external_reloaded",
+    "external_rows_merged",
+    "external_settings_merged",
+    "goodbye",
+    "guide_1",
+    "guide_10",
+    "guide_11",
+    "guide_2",
+    "guide_3",
+    "guide_4",
+    "guide_5",
+    "guide_6",
+    "guide_7",
+    "guide_8",
+    "guide_9",
+    "guide_H",
+    "guide_return",
+    "interest_applied",
+    "interest_entries",
+    "interest_menu",
+    "interest_processing",
+    "interest_removed_for",
+    "interest_set_for",
+    "interval_must_positive",
+    "invalid_alloc_sum",
+    "invalid_amount",
+    "invalid_choice",
+    "invalid_choice_m_or_a",
+    "invalid_date_format",
+    "invalid_input",
+    "invalid_input_extra",
+    "invalid_negative_percent",
+    "invalid_number",
+    "invalid_percent_over",
+    "invalid_rate_input",
+    "label_auto_process",
+    "label_auto_save",
+    "label_language",
+    "language_set",
+    "load_up_to_date",
+    "menu_1",
+    "menu_10",
+    "menu_11",
+    "menu_2",
+    "menu_3",
+    "menu_4",
+    "menu_5",
+    "menu_6",
+    "menu_7",
+    "menu_8",
+    "menu_9",
+    "menu_H",
+    "menu_title",
+    "monthly",
+    "monthly_or_annual_prompt",
+    "no_categories_entered",
+    "no_categories_selected",
+    "no_category_matches",
+    "no_interest_entries",
+    "no_save_file",
+    "no_selection_made",
+    "no_valid_categories_selected",
+    "nuke_cancel",
+    "nuke_confirm",
+    "nuke_desc",
+    "nuke_done",
+    "number_out_of_range",
+    "off",
+    "on",
+    "please_answer_c_or_r",
+    "please_answer_s_or_r",
+    "press_enter",
+    "processed_schedules",
+    "prompt_amount",
+    "prompt_amount_recurring",
+    "prompt_category",
+    "prompt_category_info",
+    "prompt_category_name",
+    "prompt_date",
+    "prompt_day_of_month",
+    "prompt_interest_categories",
+    "prompt_interest_rate",
+    "prompt_interval_days",
+    "prompt_note",
+    "prompt_setup_alloc",
+    "quick_entry_added",
+    "quick_entry_confirm_partial",
+    "quick_entry_intro",
+    "quick_entry_line_error",
+    "quick_entry_nothing_added",
+    "retrying_load",
+    "save_file_removed",
+    "saved_and_exiting",
+    "saved_exit_prompt",
+    "saved_to",
+    "saving_in_background",
+    "schedule_type_prompt",
+    "scheduled_added",
+    "selection_out_of_range",
+    "setup_alloc_later",
+    "setup_complete",
+    "starting_guide_title",
+    "still_no_save",
+    "tui_add",
+    "tui_add_prompt",
+    "tui_col_alloc",
+    "tui_col_amount",
+    "tui_col_balance",
+    "tui_col_category",
+    "tui_col_date",
+    "tui_col_note",
+    "tui_interest_count",
+    "tui_keys",
+    "tui_process",
+    "tui_processed",
+    "tui_quit",
+    "tui_save",
+    "tui_schedule",
+    "tui_schedule_count",
+    "tui_schedule_prompt",
+    "tui_summary",
+    "tui_total_balance",
+    "tui_transactions",
+    "tui_tx_count",
+    "unknown_option",
+};
+
+// Language codes as I18n stores them (uppercase), sorted
+constexpr std::string_view kCatalogLangs[kCatalogLangCount] = { "DE", "EN", "LANGFALLBACK", "VI", };
+
+// kCatalog[lang][msg]: text with fallback applied; empty if no locale has it
+constexpr std::string_view kCatalog[kCatalogLangCount][kMsgCount] = {
+    { // DE
+        "Auswahl:",
+        "Deutsch",
+        "Hinzugef\303\274gt.",
+        "Hinzugef\303\274gt und automatisch prozentual zugewiesen.",
+        "Geben Sie Prozentsatz f\303\274r jede Kategorie ein, oder lassen Sie leer, um den aktuellen Wert zu behalten.",
+        "(Hinweis: Der Anteil f\303\274r 'Andere' ist der verbleibende Prozentsatz nach diesen Zuweisungen.)",
+        "{NAME} (aktuell {PCT}%) - neuen Prozentsatz eingeben oder leer lassen, um zu behalten:",
+        "Sie haben derzeit {PCT}% f\303\274r 'Andere' verf\303\274gbar.",
+        "Aufteilungen aktualisiert. 'Andere' auf verbleibende {PCT}% gesetzt.",
+        "j\303\244hrlich",
+        "Automatische Zuweisung gilt nur f\303\274r positive Betr\303\244ge. Dieser Zeitplan ist negativ; wird in die Kategorie geschrieben.",
+        "Auto-Verarbeitung beim Start ist jetzt",
+        "Automatische Verarbeitung abgeschlossen.",
+        "Automatische Verarbeitung der Zeitpl\303\244ne und Zinsen beim Start gem\303\244\303\237 Einstellungen...",
+        "Auto-Save ist jetzt",
+        "Verf\303\274gbare Sprachen:",
+        "Kann Datei zum Laden nicht \303\266ffnen. Platzieren Sie '{SAVE_FILENAME}' im Arbeitsverzeichnis und versuchen Sie es erneut.\n",
+        "Kategorien erstellt.",
+        "... und {COUNT} weitere.",
+        "Kategorie existiert nicht: {NAME}. Erstellen (c) oder neu eingeben (r)? (c/r):",
+        "Kategorie nicht gefunden:",
+        "(Teil eines Namens gefolgt von '?' eingeben, um zu suchen, z. B. foo?)",
+        "Wenn Sie keine Kategorien eingeben, werden Standardwerte verwendet.",
+        "--- Kategorie Einrichtung ---",
+        "Geben Sie angezeigte Kategorienamen ein, je einer pro Zeile. Dr\303\274cken Sie Enter auf leerer Zeile, um zu beenden.",
+        "Auswahl:",
+        "Sprache Code oder Nummer eingeben (leer zum Abbrechen):",
+        "W\303\244hlen: (s) Neues Konto einrichten, (r) Erneut laden, nachdem Sie die Datei ins Arbeitsverzeichnis gelegt haben:",
+        "(aktuell)",
+        "Meinten Sie:",
+        "Geben Sie Nummern ein (kommagetrennt), die entfernt werden sollen:",
+        "Vorhandene Kategorien:",
+        "Programm wird beendet.",
+        "Die Speicherdatei wurde von einer anderen Instanz ersetzt und neu geladen.",
+        "{COUNT} Buchung(en) aus einer anderen Instanz \303\274bernommen.",
+        "Einstellungen, Aufteilungen, Zeitpl\303\244ne oder Zinss\303\244tze aus einer anderen Instanz \303\274bernommen.",
+        "Auf Wiedersehen!\n",
+        "1) Manuelle Transaktion hinzuf\303\274gen - Datum YYYY-MM-DD (leer = heute), Betrag (+ Einnahme / - Ausgabe), Kategorie, Notiz.\n",
+        "10) Einstellungen - Einstellungen \303\266ffnen (Auto-Save, Auto-Verarbeitung beim Start, Sprache, Zur\303\274cksetzen).\n",
+        "11) Schnelleingabe - Zeilen wie \"2026-10-01 -12.50 Food lunch\" (DATUM BETRAG KATEGORIE NOTIZ) eingeben oder einf\303\274gen; alle g\303\274ltigen Zeilen werden gemeinsam hinzugef\303\274gt.\n",
+        "2) Geplante Transaktion hinzuf\303\274gen - wiederkehrend alle X Tage oder monatlich am Tag D.\n",
+        "3) Zusammenfassung anzeigen - Kontostand, Kategoriebilanzen, Aufteilungen, letzte Transaktionen.\n",
+        "4) Aufteilungsprozents\303\244tze einstellen - legen Sie fest, wie Einkommen auf Kategorien verteilt wird.\n",
+        "5) Geplante Transaktionen bis heute verarbeiten - f\303\244llige geplante Transaktionen anwenden.\n",
+        "6) Zinsen anwenden - Zinssatz(e) festlegen und auf ausgew\303\244hlte Kategorie(n) anwenden.\n",
+        "7) Speichern - aktuelle Daten in {SAVE_FILENAME} schreiben.\n",
+        "8) Laden - Daten aus {SAVE_FILENAME} laden.\n",
+        "9) Beenden - Programm beenden.\n",
+        "H) Startanleitung - zeigt diese Hilfemeldung an.\n",
+        "- R\303\274ckkehrverhalten:\n- Nach jeder Aktion werden Sie gefragt: 'Dr\303\274cken Sie Enter, um zur Hauptoberfl\303\244che zur\303\274ckzukehren oder (s) zu speichern und zu beenden:'\n  * Dr\303\274cken Sie Enter, um zum Men\303\274 zur\303\274ckzukehren.\n  * Geben Sie 's' ein, um zu speichern und das Programm zu beenden.\n",
+        "Zinsen angewendet.",
+        "Zinseintr\303\244ge:",
+        "Zinsmen\303\274: (a) Zins hinzuf\303\274gen/aktualisieren, (r) Zins entfernen, (p) Zinsen jetzt berechnen/anwenden:",
+        "Zinsen bis {DATE} verarbeiten und anwenden...",
+        "Zinsen f\303\274r {NAME} entfernt.",
+        "Zinsen gesetzt {FREQ} {RATE}% f\303\274r Kategorie '{NAME}' ab {DATE}.",
+        "Intervall muss > 0 sein.",
+        "Ung\303\274ltige Aufteilung: Kategorien summieren sich auf {TOTAL}%. Muss zwischen 0 und 100 liegen. Bitte erneut eingeben.",
+        "Ung\303\274ltiger Betrag.",
+        "Ung\303\274ltige Auswahl.",
+        "Ung\303\274ltige Auswahl. Bitte geben Sie 'm' oder 'a' ein.",
+        "Ung\303\274ltiges Datumsformat. Verwenden Sie YYYY-MM-DD.",
+        "Ung\303\274ltige Eingabe. Versuchen Sie es erneut.",
+        "Ung\303\274ltige Eingabe (zus\303\244tzliche Zeichen). Versuchen Sie es erneut.",
+        "Negative Prozents\303\244tze sind nicht erlaubt. Bitte geben Sie einen Wert zwischen 0 und 100 ein.",
+        "Ung\303\274ltige Zahl. Versuchen Sie es erneut.",
+        "Prozentsatz darf 100 nicht \303\274berschreiten. Bitte geben Sie einen Wert zwischen 0 und 100 ein.",
+        "Ung\303\274ltige Zinsangabe.",
+        "2. Auto Prozess Zeitpl\303\244ne & Zinsen beim Start:",
+        "1. Auto-Save:",
+        "3. Sprache:",
+        "Sprache auf {LANG} gesetzt.",
+        "Bereits auf dem Stand der Speicherdatei.",
+        "1) Manuelle Transaktion hinzuf\303\274gen",
+        "10) Einstellungen",
+        "11) Schnelleingabe (eine Zeile pro Buchung, mehrere einf\303\274gen)",
+        "2) Geplante Transaktion hinzuf\303\274gen",
+        "3) Zusammenfassung anzeigen",
+        "4) Aufteilungsprozents\303\244tze einstellen",
+        "5) Geplante Transaktionen bis heute verarbeiten",
+        "6) Zinsen anwenden",
+        "7) Speichern",
+        "8) Laden",
+        "9) Beenden",
+        "H) Startanleitung",
+        "== Finanzverwaltung ===",
+        "monatlich",
+        "(M) monatlich oder (A) j\303\244hrlich? [m/a]:",
+        "Keine Kategorien eingegeben. Standardwerte werden verwendet (Notfall, Unterhaltung, Sparen, Andere).",
+        "Keine Kategorien ausgew\303\244hlt.",
+        "Keine passenden Kategorien.",
+        "Keine Zinseintr\303\244ge zum Entfernen.",
+        "Keine Speicherdatei zum Entfernen vorhanden oder Entfernen fehlgeschlagen (Datei existiert m\303\266glicherweise nicht).\n",
+        "Keine Auswahl getroffen.",
+        "Keine g\303\274ltigen Kategorien ausgew\303\244hlt.",
+        "Zur\303\274cksetzen abgebrochen.\n",
+        "M\303\266chten Sie das Programm wirklich zur\303\274cksetzen? (Alles wird in den Anfangszustand versetzt) [y/N]:",
+        "(n) Programm zur\303\274cksetzen (zur\303\274cksetzen und Speicherdaten l\303\266schen)",
+        "Programm zur\303\274ckgesetzt: R\303\274ckkehr zum Anfangszustand.\n",
+        "Zahl au\303\237erhalb des Bereichs.",
+        "AUS",
+        "EIN",
+        "Bitte antworten Sie mit 'c' zum Erstellen oder 'r' zum Neuerfassen.",
+        "Bitte antworten Sie mit 's' zum Einrichten oder 'r' zum erneuten Versuch.",
+        "Dr\303\274cken Sie Enter, um zum Hauptmen\303\274 zur\303\274ckzukehren.\n",
+        "Zeitpl\303\244ne verarbeitet.",
+        "Betrag (positiv = Einnahme, negativ = Ausgabe):",
+        "Betrag (positiv = wiederkehrende Einnahme, negativ = wiederkehrende Ausgabe):",
+        "Kategorie (Name oder Nummer) [leer = automatische Aufteilung]:",
+        "Kategorie oder deren Nummer eingeben, oder leer lassen f\303\274r automatische Aufteilung (bei Einnahmen).",
+        "Kategoriename (leer = fertig):",
+        "Datum (YYYY-MM-DD) [leer = heute]:",
+        "Tag des Monats eingeben (1-31):",
+        "W\303\244hlen Sie Kategorie(n) f\303\274r Zinsanwendung (Nummern durch Komma getrennt oder Namen durch Komma getrennt):",
+        "Zinssatz eingeben (z.B. '0.5%', '0,5', '5.5', '5,5%'):",
+        "Intervall eingeben (Tage):",
+        "Notiz:",
+        "M\303\266chten Sie jetzt Aufteilungsprozents\303\244tze festlegen? (s = jetzt setzen, l = sp\303\244ter lassen) [s/l]:",
+        "{COUNT} Buchung(en) hinzugef\303\274gt.",
+        "Einige Zeilen sind fehlerhaft. Die {COUNT} g\303\274ltigen Buchungen trotzdem hinzuf\303\274gen? (y/n):",
+        "Schnelleingabe: eine Buchung pro Zeile als DATUM BETRAG KATEGORIE [NOTIZ].\nDATUM ist JJJJ-MM-TT oder \"today\"; KATEGORIE \"auto\" verteilt Einnahmen automatisch; Namen mit Leerzeichen in Anf\303\274hrungszeichen.\nBeliebig viele Zeilen einf\303\274gen und mit einer leeren Zeile abschlie\303\237en:",
+        "Zeile {LINE}:",
+        "Keine Buchungen hinzugef\303\274gt.",
+        "Ladevorgang wird erneut versucht...",
+        "Speicherdatei entfernt.",
+        "Gespeichert. Beende.",
+        "\nDr\303\274cken Sie Enter, um zur Hauptoberfl\303\244che zur\303\274ckzukehren oder (s) zum Speichern und Beenden:",
+        "Gespeichert unter",
+        "Speichern l\303\244uft im Hintergrund; Sie werden benachrichtigt, sobald es fertig ist.",
+        "Typ: 1) Alle X Tage  2) Monatlich am Tag D:",
+        "Geplante Transaktion hinzugef\303\274gt.",
+        "Auswahl au\303\237erhalb des Bereichs:",
+        "Sie k\303\266nnen die Aufteilungen sp\303\244ter \303\274ber Men\303\274option 4 festlegen.",
+        "Alles ist eingerichtet!",
+        "\n=== Startanleitung ===\n",
+        "Speicherdatei noch nicht gefunden. Sie k\303\266nnen '{SAVE_FILENAME}' ins Arbeitsverzeichnis legen und (r) w\303\244hlen, oder (s) zum Einrichten w\303\244hlen.",
+        "Buchung hinzuf\303\274gen",
+        "Hinzuf\303\274gen (DATUM BETRAG KATEGORIE [NOTIZ]; Enter: ok, Esc: abbrechen):",
+        "Anteil %",
+        "Betrag",
+        "Saldo",
+        "Kategorie",
+        "Datum",
+        "Notiz",
+        "Zinsregeln: {COUNT}",
+        "1/2/Tab: Ansicht wechseln   Auf/Ab Bild auf/ab Pos1/Ende: bl\303\244ttern   a: hinzuf\303\274gen   r: Zeitplan   p: verarbeiten   s: speichern   q: beenden",
+        "F\303\244llige verarbeiten",
+        "F\303\244llige Zeitpl\303\244ne und Zinsen verarbeitet: {COUNT} neue Buchungen.",
+        "Beenden",
+        "Speichern",
+        "Zeitplan hinzuf\303\274gen",
+        "Zeitpl\303\244ne: {COUNT}",
+        "Zeitplan (every|monthly PARAM BETRAG START KATEGORIE [NOTIZ]):",
+        "\303\234bersicht",
+        "Gesamtsaldo: {TOTAL}",
+        "Buchungen",
+        "Buchungen: {COUNT}",
+        "Unbekannte Option.",
+    },
+    { // EN
+        "",
+        "English",
+        "Added.",
+        "Added and auto-allocated by percentages.",
+        "Enter percentage for each category, or leave blank to keep current.",
+        "(Note: 'Other' percent is the remaining after these assignments.)",
+        "{NAME} (current {PCT}%) - enter new percent or blank to keep:",
+        "You currently have {PCT}% available for Other.",
+        "Allocations updated. 'Other' set to remaining {PCT}%.",
+        "annual",
+        "Auto-allocate only applies to positive amounts. This schedule is negative; will write to category.",
+        "Auto process at startup is now",
+        "Auto-processing complete.",
+        "Auto-processing schedules and interest at startup as per settings...",
+        "Auto-save is now",
+        "Available languages:",
+        "Cannot open file to load. Place '{SAVE_FILENAME}' in the working directory and try again.\n",
+        "Categories created.",
+        "... and {COUNT} more.",
+        "Category does not exist: {NAME}. Create it (c) or retype (r)? (c/r):",
+        "Category not found:",
+        "(Type part of a name followed by '?' to search, e.g. foo?)",
+        "If you enter no categories, defaults will be used.",
+        "--- Category setup ---",
+        "Enter category display names, one per line. Press Enter on an empty line to finish.",
+        "Choice:",
+        "Choose language code or number (blank to cancel):",
+        "Choose: (s)et up new account, (r)etry loading save file after placing it in working directory:",
+        "(current)",
+        "Did you mean:",
+        "Enter numbers (comma-separated) to remove:",
+        "Existing categories:",
+        "Exiting program.",
+        "The save file was replaced by another instance; reloaded it.",
+        "Picked up {COUNT} transaction(s) saved by another instance.",
+        "Picked up settings, allocations, schedules or interest rates saved by another instance.",
+        "Goodbye!",
+        "1) Add manual transaction - date YYYY-MM-DD (empty = today), amount (+ income / - expense), category, note.\n",
+        "10) Settings - open Settings (Auto-save, Auto-process at startup, Language, Nuke).\n",
+        "11) Quick entry - type or paste lines like \"2026-10-01 -12.50 Food lunch\" (DATE AMOUNT CATEGORY NOTE); all valid lines are added together.\n",
+        "2) Add scheduled transaction - recurring every X days or monthly on day D.\n",
+        "3) Show summary - total balance, category balances, allocations, recent txs.\n",
+        "4) Set allocation percentages - define how income is split across categories.\n",
+        "5) Process schedules up to today - apply scheduled transactions that are due.\n",
+        "6) Apply saving interest - set rate(s) and apply interest to selected category(ies).\n",
+        "7) Save - write current data to {SAVE_FILENAME}.\n",
+        "8) Load - load data from {SAVE_FILENAME}.\n",
+        "9) Exit - quit program.\n",
+        "H) Starting Guide - show this help message.\n",
+        "- Return behavior:\n- After each action you'll be prompted: 'Enter to return to Main Interface or (s)ave and exist:'\n  * Press Enter to return to menu.\n  * Enter 's' to save and exit the program.\n",
+        "Interest applied.",
+        "Interest entries:",
+        "Interest menu: (a) add/update interest, (r) remove interest, (p) process/apply interest now:",
+        "Processing & applying interest up to {DATE}...",
+        "Removed interest for {NAME}.",
+        "Set interest {FREQ} {RATE}% for category '{NAME}' starting {DATE}.",
+        "Interval must be > 0.",
+        "Invalid allocation: categories sum to {TOTAL}%. Must be between 0 and 100. Please re-enter.",
+        "Invalid amount.",
+        "Invalid choice.",
+        "Invalid choice. Please enter 'm' or 'a'.",
+        "Invalid date format. Use YYYY-MM-DD.",
+        "Invalid input. Try again.",
+        "Invalid input (extra chars). Try again.",
+        "Negative percentages are not allowed. Please enter a value between 0 and 100.",
+        "Invalid number. Try again.",
+        "Percent cannot exceed 100. Please enter a value between 0 and 100.",
+        "Invalid rate input.",
+        "2. Auto process schedules & interest at startup:",
+        "1. Auto-save:",
+        "3. Language:",
+        "Language set to {LANG}.",
+        "Already up to date with the save file.",
+        "1) Add manual transaction",
+        "10) Settings",
+        "11) Quick entry (one line per transaction, paste many)",
+        "2) Add scheduled transaction",
+        "3) Show summary",
+        "4) Set allocation percentages",
+        "5) Process schedules up to today",
+        "6) Apply saving interest",
+        "7) Save",
+        "8) Load",
+        "9) Exit",
+        "H) Starting Guide",
+        "== Finance Manager ===",
+        "monthly",
+        "(M) monthly or (A) annually? [m/a]:",
+        "No categories entered. Using defaults (Emergency, Entertainment, Saving, Other).",
+        "No categories selected.",
+        "No matching categories.",
+        "No interest entries to remove.",
+        "No save file to remove or failed to remove (it might not exist).\n",
+        "No selection made.",
+        "No valid categories selected.",
+        "Nuke cancelled.\n",
+        "Do you really want to nuke your program? (Everything will return to its initial state) [y/N]:",
+        "(n) Nuke program (reset and delete save file)",
+        "Program nuked: returned to initial state.\n",
+        "Number out of range.",
+        "OFF",
+        "ON",
+        "Please answer 'c' to create or 'r' to re-enter.",
+        "Please answer 's' to set up or 'r' to retry.",
+        "Press Enter to go back to main menu.\n",
+        "Processed schedules.",
+        "Amount (positive = income, negative = expense):",
+        "Amount (positive = recurring income, negative = recurring expense):",
+        "Category (name or number) [blank = Auto-allocate]:",
+        "Enter category or its number, or leave blank for Auto-allocate (for incomes).",
+        "Category name (empty = finish):",
+        "Date (YYYY-MM-DD) [empty = today]:",
+        "Enter day of month (1-31):",
+        "Choose category (or categories) to apply interest (numbers comma-separated, or names comma-separated):",
+        "Enter interest (e.g., '0.5%', '0,5', '5.5', '5,5%'):",
+        "Enter interval (days):",
+        "Note:",
+        "Would you like to set allocation percentages now? (s = set now, l = leave and set later) [s/l]:",
+        "Added {COUNT} transaction(s).",
+        "Some lines have errors. Add the {COUNT} valid transaction(s) anyway? (y/n):",
+        "Quick entry: one transaction per line as DATE AMOUNT CATEGORY [NOTE].\nDATE is YYYY-MM-DD or \"today\"; CATEGORY \"auto\" auto-allocates income; quote names with spaces.\nPaste as many lines as you like, then finish with an empty line:",
+        "Line {LINE}:",
+        "No transactions added.",
+        "Retrying load...",
+        "Save file removed.",
+        "Saved. Exiting.",
+        "\nEnter to return to Main Interface or (s)ave and exist:",
+        "Saved to",
+        "Saving in the background; you will be notified when it finishes.",
+        "Type: 1) Every X days  2) Monthly on day D:",
+        "Scheduled transaction added.",
+        "Selection out of range:",
+        "You can set allocations later from menu option 4.",
+        "You are all set!",
+        "\n=== Starting Guide ===\n",
+        "Still cannot find save file. You can place '{SAVE_FILENAME}' into the working directory and choose (r) again, or choose (s) to set up new.",
+        "Add transaction",
+        "Add (DATE AMOUNT CATEGORY [NOTE]; Enter: ok, Esc: cancel):",
+        "Alloc %",
+        "Amount",
+        "Balance",
+        "Category",
+        "Date",
+        "Note",
+        "Interest rules: {COUNT}",
+        "1/2/Tab: switch view   Up/Down PgUp/PgDn Home/End: scroll   a: add   r: schedule   p: process   s: save   q: quit",
+        "Process due",
+        "Processed due schedules and interest: {COUNT} new transactions.",
+        "Quit",
+        "Save",
+        "Add schedule",
+        "Schedules: {COUNT}",
+        "Schedule (every|monthly PARAM AMOUNT START CATEGORY [NOTE]):",
+        "Summary",
+        "Total balance: {TOTAL}",
+        "Transactions",
+        "Transactions: {COUNT}",
+        "Unknown option.",
+    },
+    { // LANGFALLBACK
+        "",
+        "Fallback (DO NOT EDIT)",
+        "Added.",
+        "Added and auto-allocated by percentages.",
+        "Enter percentage for each category, or leave blank to keep current.",
+        "(Note: 'Other' percent is the remaining after these assignments.)",
+        "{NAME} (current {PCT}%) - enter new percent or blank to keep:",
+        "You currently have {PCT}% available for Other.",
+        "Allocations updated. 'Other' set to remaining {PCT}%.",
+        "annual",
+        "Auto-allocate only applies to positive amounts. This schedule is negative; will write to category.",
+        "Auto process at startup is now",
+        "Auto-processing complete.",
+        "Auto-processing schedules and interest at startup as per settings...",
+        "Auto-save is now",
+        "Available languages:",
+        "Cannot open file to load. Place '{SAVE_FILENAME}' in the working directory and try again.\n",
+        "Categories created.",
+        "... and {COUNT} more.",
+        "Category does not exist: {NAME}. Create it (c) or retype (r)? (c/r):",
+        "Category not found:",
+        "(Type part of a name followed by '?' to search, e.g. foo?)",
+        "If you enter no categories, defaults will be used.",
+        "--- Category setup ---",
+        "Enter category display names, one per line. Press Enter on an empty line to finish.",
+        "Choice:",
+        "Choose language code or number (blank to cancel):",
+        "Choose: (s)et up new account, (r)etry loading save file after placing it in working directory:",
+        "(current)",
+        "Did you mean:",
+        "Enter numbers (comma-separated) to remove:",
+        "Existing categories:",
+        "Exiting program.",
+        "The save file was replaced by another instance; reloaded it.",
+        "Picked up {COUNT} transaction(s) saved by another instance.",
+        "Picked up settings, allocations, schedules or interest rates saved by another instance.",
+        "Goodbye!",
+        "1) Add manual transaction - date YYYY-MM-DD (empty = today), amount (+ income / - expense), category, note.\n",
+        "10) Settings - open Settings (Auto-save, Auto-process at startup, Language, Nuke).\n",
+        "11) Quick entry - type or paste lines like \"2026-10-01 -12.50 Food lunch\" (DATE AMOUNT CATEGORY NOTE); all valid lines are added together.\n",
+        "2) Add scheduled transaction - recurring every X days or monthly on day D.\n",
+        "3) Show summary - total balance, category balances, allocations, recent txs.\n",
+        "4) Set allocation percentages - define how income is split across categories.\n",
+        "5) Process schedules up to today - apply scheduled transactions that are due.\n",
+        "6) Apply saving interest - set rate(s) and apply interest to selected category(ies).\n",
+        "7) Save - write current data to {SAVE_FILENAME}.\n",
+        "8) Load - load data from {SAVE_FILENAME}.\n",
+        "9) Exit - quit program.\n",
+        "H) Starting Guide - show this help message.\n",
+        "- Return behavior:\n- After each action you'll be prompted: 'Enter to return to Main Interface or (s)ave and exist:'\n  * Press Enter to return to menu.\n  * Enter 's' to save and exit the program.\n",
+        "Interest applied.",
+        "Interest entries:",
+        "Interest menu: (a) add/update interest, (r) remove interest, (p) process/apply interest now:",
+        "Processing & applying interest up to {DATE}...",
+        "Removed interest for {NAME}.",
+        "Set interest {FREQ} {RATE}% for category '{NAME}' starting {DATE}.",
+        "Interval must be > 0.",
+        "Invalid allocation: categories sum to {TOTAL}%. Must be between 0 and 100. Please re-enter.",
+        "Invalid amount.",
+        "Invalid choice.",
+        "Invalid choice. Please enter 'm' or 'a'.",
+        "Invalid date format. Use YYYY-MM-DD.",
+        "Invalid input. Try again.",
+        "Invalid input (extra chars). Try again.",
+        "Negative percentages are not allowed. Please enter a value between 0 and 100.",
+        "Invalid number. Try again.",
+        "Percent cannot exceed 100. Please enter a value between 0 and 100.",
+        "Invalid rate input.",
+        "2. Auto process schedules & interest at startup:",
+        "1. Auto-save:",
+        "3. Language:",
+        "Language set to {LANG}.",
+        "Already up to date with the save file.",
+        "1) Add manual transaction",
+        "10) Exit",
+        "11) Quick entry",
+        "2) Schedules",
+        "3) Settings",
+        "4) Summary",
+        "5) Interests",
+        "6) Allocations",
+        "7) Categories",
+        "8) Schedules",
+        "9) Save",
+        "H: Help",
+        "Personal Finance Manager",
+        "monthly",
+        "(M) monthly or (A) annually? [m/a]:",
+        "No categories entered. Using defaults (Emergency, Entertainment, Saving, Other).",
+        "No categories selected.",
+        "No matching categories.",
+        "No interest entries to remove.",
+        "No save file to remove or failed to remove (it might not exist).\n",
+        "No selection made.",
+        "No valid categories selected.",
+        "Nuke cancelled.\n",
+        "Do you really want to nuke your program? (Everything will return to its initial state) [y/N]:",
+        "(n) Nuke program (reset and delete save file)",
+        "Program nuked: returned to initial state.\n",
+        "Number out of range.",
+        "OFF",
+        "ON",
+        "Please answer 'c' to create or 'r' to re-enter.",
+        "Please answer 's' to set up or 'r' to retry.",
+        "Press Enter to continue",
+        "Processed schedules.",
+        "Amount (positive = income, negative = expense):",
+        "Amount (positive = recurring income, negative = recurring expense):",
+        "Category (name or number) [blank = Auto-allocate]:",
+        "Enter category or its number, or leave blank for Auto-allocate (for incomes).",
+        "Category name (empty = finish):",
+        "Date (YYYY-MM-DD) [empty = today]:",
+        "Enter day of month (1-31):",
+        "Choose category (or categories) to apply interest (numbers comma-separated, or names comma-separated):",
+        "Enter interest (e.g., '0.5%', '0,5', '5.5', '5,5%'):",
+        "Enter interval (days):",
+        "Note:",
+        "Would you like to set allocation percentages now? (s = set now, l = leave and set later) [s/l]:",
+        "Added {COUNT} transaction(s).",
+        "Some lines have errors. Add the {COUNT} valid transaction(s) anyway? (y/n):",
+        "Quick entry: one transaction per line as DATE AMOUNT CATEGORY [NOTE].\nDATE is YYYY-MM-DD or \"today\"; CATEGORY \"auto\" auto-allocates income; quote names with spaces.\nPaste as many lines as you like, then finish with an empty line:",
+        "Line {LINE}:",
+        "No transactions added.",
+        "Retrying load...",
+        "Save file removed.",
+        "Saved. Exiting.",
+        "\nEnter to return to Main Interface or (s)ave and exist:",
+        "Saved to",
+        "Saving in the background; you will be notified when it finishes.",
+        "Type: 1) Every X days  2) Monthly on day D:",
+        "Scheduled transaction added.",
+        "Selection out of range:",
+        "You can set allocations later from menu option 4.",
+        "You are all set!",
+        "\n=== Starting Guide ===\n",
+        "Still cannot find save file. You can place '{SAVE_FILENAME}' into the working directory and choose (r) again, or choose (s) to set up new.",
+        "Add transaction",
+        "Add (DATE AMOUNT CATEGORY [NOTE]; Enter: ok, Esc: cancel):",
+        "Alloc %",
+        "Amount",
+        "Balance",
+        "Category",
+        "Date",
+        "Note",
+        "Interest rules: {COUNT}",
+        "1/2/Tab: switch view   Up/Down PgUp/PgDn Home/End: scroll   a: add   r: schedule   p: process   s: save   q: quit",
+        "Process due",
+        "Processed due schedules and interest: {COUNT} new transactions.",
+        "Quit",
+        "Save",
+        "Add schedule",
+        "Schedules: {COUNT}",
+        "Schedule (every|monthly PARAM AMOUNT START CATEGORY [NOTE]):",
+        "Summary",
+        "Total balance: {TOTAL}",
+        "Transactions",
+        "Transactions: {COUNT}",
+        "Unknown option.",
+    },
+    { // VI
+        "",
+        "Ti\341\272\277ng Vi\341\273\207t",
+        "\304\220\303\243 th\303\252m.",
+        "\304\220\303\243 th\303\252m v\303\240 t\341\273\261 \304\221\341\273\231ng ph\303\242n b\341\273\225 theo ph\341\272\247n tr\304\203m.",
+        "Nh\341\272\255p ph\341\272\247n tr\304\203m cho m\341\273\227i lo\341\272\241i, \304\221\341\273\203 tr\341\273\221ng \304\221\341\273\203 gi\341\273\257 gi\303\241 tr\341\273\213 hi\341\273\207n t\341\272\241i.",
+        "(Ghi ch\303\272: 'Other' l\303\240 ph\341\272\247n c\303\262n l\341\272\241i sau khi g\303\241n.)",
+        "{NAME} (hi\341\273\207n {PCT}%) - nh\341\272\255p ph\341\272\247n tr\304\203m m\341\273\233i ho\341\272\267c tr\341\273\221ng \304\221\341\273\203 gi\341\273\257:",
+        "B\341\272\241n hi\341\273\207n c\303\263 {PCT}% d\303\240nh cho Other.",
+        "\304\220\303\243 c\341\272\255p nh\341\272\255t ph\303\242n b\341\273\225. 'Other' l\303\240 {PCT}%.",
+        "h\303\240ng n\304\203m",
+        "T\341\273\261 \304\221\341\273\231ng ph\303\242n b\341\273\225 ch\341\273\211 \303\241p d\341\273\245ng cho s\341\273\221 d\306\260\306\241ng. L\341\273\213ch n\303\240y l\303\240 s\341\273\221 \303\242m; s\341\272\275 ghi v\303\240o lo\341\272\241i.",
+        "T\341\273\261 \304\221\341\273\231ng x\341\273\255 l\303\275 khi kh\341\273\237i \304\221\341\273\231ng b\303\242y gi\341\273\235",
+        "Ho\303\240n t\341\272\245t t\341\273\261 \304\221\341\273\231ng x\341\273\255 l\303\275.",
+        "T\341\273\261 \304\221\341\273\231ng x\341\273\255 l\303\275 l\341\273\213ch v\303\240 l\303\243i t\341\272\241i kh\341\273\237i \304\221\341\273\231ng theo c\303\240i \304\221\341\272\267t...",
+        "T\341\273\261 \304\221\341\273\231ng l\306\260u b\303\242y gi\341\273\235",
+        "C\303\241c ng\303\264n ng\341\273\257 c\303\263 s\341\272\265n:",
+        "Kh\303\264ng th\341\273\203 m\341\273\237 t\341\273\207p \304\221\341\273\203 t\341\272\243i. \304\220\341\272\267t '{SAVE_FILENAME}' v\303\240o th\306\260 m\341\273\245c l\303\240m vi\341\273\207c v\303\240 th\341\273\255 l\341\272\241i.\n",
+        "\304\220\303\243 t\341\272\241o lo\341\272\241i.",
+        "... v\303\240 {COUNT} danh m\341\273\245c kh\303\241c.",
+        "Lo\341\272\241i kh\303\264ng t\341\273\223n t\341\272\241i: {NAME}. T\341\272\241o (c) hay nh\341\272\255p l\341\272\241i (r)? (c/r):",
+        "Kh\303\264ng t\303\254m th\341\272\245y lo\341\272\241i:",
+        "(G\303\265 m\341\273\231t ph\341\272\247n t\303\252n k\303\250m '?' \304\221\341\273\203 t\303\254m, v\303\255 d\341\273\245 foo?)",
+        "N\341\272\277u kh\303\264ng nh\341\272\255p, d\303\271ng m\341\272\267c \304\221\341\273\213nh.",
+        "--- Thi\341\272\277t l\341\272\255p lo\341\272\241i ---",
+        "Nh\341\272\255p t\303\252n lo\341\272\241i, m\341\273\227i d\303\262ng m\341\273\231t lo\341\272\241i. Nh\341\272\245n Enter tr\303\252n d\303\262ng tr\341\273\221ng \304\221\341\273\203 k\341\272\277t th\303\272c.",
+        "L\341\273\261a ch\341\273\215n:",
+        "M\303\243 ng\303\264n ng\341\273\257 ho\341\272\267c s\341\273\221 (kh\303\264ng nh\341\272\255p \304\221\341\273\203 h\341\273\247y):",
+        "Ch\341\273\215n: (s) thi\341\272\277t l\341\272\255p t\303\240i kho\341\272\243n m\341\273\233i, (r) th\341\273\255 t\341\272\243i l\341\272\241i t\341\273\207p l\306\260u sau khi \304\221\341\272\267t v\303\240o th\306\260 m\341\273\245c l\303\240m vi\341\273\207c:",
+        "(\304\221ang s\341\273\255 d\341\273\245ng)",
+        "C\303\263 ph\341\272\243i b\341\272\241n mu\341\273\221n:",
+        "Nh\341\272\255p s\341\273\221 (c\303\241c s\341\273\221 c\303\241ch nhau d\341\272\245u ph\341\272\251y) \304\221\341\273\203 x\303\263a:",
+        "C\303\241c lo\341\272\241i hi\341\273\207n c\303\263:",
+        "Tho\303\241t ch\306\260\306\241ng tr\303\254nh.",
+        "T\341\273\207p l\306\260u \304\221\303\243 \304\221\306\260\341\273\243c phi\303\252n kh\303\241c thay th\341\272\277; \304\221\303\243 t\341\272\243i l\341\272\241i.",
+        "\304\220\303\243 nh\341\272\255n {COUNT} giao d\341\273\213ch \304\221\306\260\341\273\243c l\306\260u b\341\273\237i phi\303\252n kh\303\241c.",
+        "\304\220\303\243 nh\341\272\255n thay \304\221\341\273\225i c\303\240i \304\221\341\272\267t, ph\303\242n b\341\273\225, l\341\273\213ch ho\341\272\267c l\303\243i su\341\272\245t \304\221\306\260\341\273\243c l\306\260u b\341\273\237i phi\303\252n kh\303\241c.",
+        "T\341\272\241m bi\341\273\207t!",
+        "1) Th\303\252m giao d\341\273\213ch th\341\273\247 c\303\264ng - ng\303\240y YYYY-MM-DD (tr\341\273\221ng = h\303\264m nay), s\341\273\221 ti\341\273\201n (+ thu nh\341\272\255p / - chi ti\303\252u), lo\341\272\241i, ghi ch\303\272.\n",
+        "10) C\303\240i \304\221\341\272\267t - m\341\273\237 C\303\240i \304\221\341\272\267t (T\341\273\261 \304\221\341\273\231ng l\306\260u, T\341\273\261 \304\221\341\273\231ng x\341\273\255 l\303\275 khi kh\341\273\237i \304\221\341\273\231ng, Ng\303\264n ng\341\273\257, Nuke).\n",
+        "11) Nh\341\272\255p nhanh - g\303\265 ho\341\272\267c d\303\241n c\303\241c d\303\262ng nh\306\260 \"2026-10-01 -12.50 Food lunch\" (NG\303\200Y S\341\273\220_TI\341\273\200N DANH_M\341\273\244C GHI_CH\303\232); m\341\273\215i d\303\262ng h\341\273\243p l\341\273\207 \304\221\306\260\341\273\243c th\303\252m c\303\271ng l\303\272c.\n",
+        "2) Th\303\252m giao d\341\273\213ch \304\221\341\273\213nh k\341\273\263 - l\341\272\267p m\341\273\227i X ng\303\240y ho\341\272\267c h\303\240ng th\303\241ng v\303\240o ng\303\240y D.\n",
+        "3) Hi\341\273\203n th\341\273\213 t\303\263m t\341\272\257t - t\341\273\225ng s\341\273\221 d\306\260, s\341\273\221 d\306\260 theo lo\341\272\241i, ph\303\242n b\341\273\225, giao d\341\273\213ch g\341\272\247n \304\221\303\242y.\n",
+        "4) Thi\341\272\277t l\341\272\255p t\341\273\211 l\341\273\207 ph\303\242n b\341\273\225 - \304\221\341\273\213nh ngh\304\251a c\303\241ch thu nh\341\272\255p \304\221\306\260\341\273\243c chia.\n",
+        "5) X\341\273\255 l\303\275 l\341\273\213ch \304\221\341\272\277n h\303\264m nay - \303\241p d\341\273\245ng c\303\241c giao d\341\273\213ch \304\221\341\273\213nh k\341\273\263 \304\221\341\272\277n h\303\264m nay.\n",
+        "6) \303\201p d\341\273\245ng l\303\243i ti\341\272\277t ki\341\273\207m - \304\221\341\272\267t l\303\243i cho c\303\241c lo\341\272\241i v\303\240 \303\241p d\341\273\245ng.\n",
+        "7) L\306\260u - ghi d\341\273\257 li\341\273\207u hi\341\273\207n t\341\272\241i v\303\240o {SAVE_FILENAME}.\n",
+        "8) T\341\272\243i - t\341\272\243i d\341\273\257 li\341\273\207u t\341\273\253 {SAVE_FILENAME}.\n",
+        "9) Tho\303\241t - tho\303\241t ch\306\260\306\241ng tr\303\254nh.\n",
+        "H) H\306\260\341\273\233ng d\341\272\253n b\341\272\257t \304\221\341\272\247u - hi\341\273\207n h\306\260\341\273\233ng d\341\272\253n n\303\240y.\n",
+        "- H\303\240nh vi tr\341\272\243 v\341\273\201:\n* Nh\341\272\245n Enter \304\221\341\273\203 quay l\341\272\241i menu.\n* G\303\265 's' \304\221\341\273\203 l\306\260u v\303\240 tho\303\241t ch\306\260\306\241ng tr\303\254nh.\n",
+        "\304\220\303\243 \303\241p d\341\273\245ng l\303\243i.",
+        "C\303\241c m\341\273\245c l\303\243i:",
+        "Menu l\303\243i: (a) th\303\252m/c\341\272\255p nh\341\272\255t l\303\243i, (r) x\303\263a l\303\243i, (p) x\341\273\255 l\303\275/\303\241p d\341\273\245ng l\303\243i ngay:",
+        "\304\220ang x\341\273\255 l\303\275 & \303\241p d\341\273\245ng l\303\243i \304\221\341\272\277n {DATE}...",
+        "\304\220\303\243 x\303\263a l\303\243i cho {NAME}",
+        "\304\220\341\272\267t l\303\243i {FREQ} {RATE}% cho lo\341\272\241i '{NAME}' b\341\272\257t \304\221\341\272\247u {DATE}.",
+        "Kho\341\272\243ng ph\341\272\243i > 0.",
+        "T\341\273\225ng ph\303\242n b\341\273\225 kh\303\264ng h\341\273\243p l\341\273\207: {TOTAL}%. Ph\341\272\243i l\303\240 0-100. Nh\341\272\255p l\341\272\241i.",
+        "S\341\273\221 ti\341\273\201n kh\303\264ng h\341\273\243p l\341\273\207.",
+        "L\341\273\261a ch\341\273\215n kh\303\264ng h\341\273\243p l\341\273\207.",
+        "L\341\273\261a ch\341\273\215n kh\303\264ng h\341\273\243p l\341\273\207. Vui l\303\262ng nh\341\272\255p 'm' ho\341\272\267c 'a'.",
+        "\304\220\341\273\213nh d\341\272\241ng ng\303\240y kh\303\264ng h\341\273\243p l\341\273\207. D\303\271ng YYYY-MM-DD.",
+        "D\341\273\257 li\341\273\207u kh\303\264ng h\341\273\243p l\341\273\207. Th\341\273\255 l\341\272\241i.",
+        "D\341\273\257 li\341\273\207u kh\303\264ng h\341\273\243p l\341\273\207 (k\303\275 t\341\273\261 th\341\273\253a). Th\341\273\255 l\341\272\241i.",
+        "Kh\303\264ng cho ph\303\251p \303\242m. Nh\341\272\255p 0-100.",
+        "S\341\273\221 kh\303\264ng h\341\273\243p l\341\273\207. Th\341\273\255 l\341\272\241i.",
+        "Ph\341\272\247n tr\304\203m kh\303\264ng qu\303\241 100. Nh\341\272\255p 0-100.",
+        "D\341\273\257 li\341\273\207u l\303\243i kh\303\264ng h\341\273\243p l\341\273\207.",
+        "2. T\341\273\261 \304\221\341\273\231ng x\341\273\255 l\303\275 l\341\273\213ch & l\303\243i khi kh\341\273\237i \304\221\341\273\231ng:",
+        "1. T\341\273\261 \304\221\341\273\231ng l\306\260u:",
+        "3. Ng\303\264n ng\341\273\257:",
+        "Ng\303\264n ng\341\273\257 \304\221\341\272\267t th\303\240nh {LANG}.",
+        "D\341\273\257 li\341\273\207u \304\221\303\243 kh\341\273\233p v\341\273\233i t\341\273\207p l\306\260u.",
+        "1) Th\303\252m giao d\341\273\213ch th\341\273\247 c\303\264ng",
+        "10) C\303\240i \304\221\341\272\267t",
+        "11) Nh\341\272\255p nhanh (m\341\273\227i d\303\262ng m\341\273\231t giao d\341\273\213ch, c\303\263 th\341\273\203 d\303\241n nhi\341\273\201u d\303\262ng)",
+        "2) Th\303\252m giao d\341\273\213ch \304\221\341\273\213nh k\341\273\263",
+        "3) Hi\341\273\203n th\341\273\213 t\303\263m t\341\272\257t",
+        "4) Thi\341\272\277t l\341\272\255p t\341\273\211 l\341\273\207 ph\303\242n b\341\273\225",
+        "5) X\341\273\255 l\303\275 l\341\273\213ch \304\221\341\272\277n h\303\264m nay",
+        "6) \303\201p d\341\273\245ng l\303\243i ti\341\272\277t ki\341\273\207m",
+        "7) L\306\260u",
+        "8) T\341\272\243i",
+        "9) Tho\303\241t",
+        "H) H\306\260\341\273\233ng d\341\272\253n b\341\272\257t \304\221\341\272\247u",
+        "== Tr\303\254nh qu\341\272\243n l\303\275 T\303\240i ch\303\255nh ===",
+        "h\303\240ng th\303\241ng",
+        "(M) h\303\240ng th\303\241ng hay (A) h\303\240ng n\304\203m? [m/a]:",
+        "Kh\303\264ng nh\341\272\255p lo\341\272\241i. D\303\271ng m\341\272\267c \304\221\341\273\213nh (Emergency, Entertainment, Saving, Other).",
+        "Kh\303\264ng c\303\263 lo\341\272\241i \304\221\306\260\341\273\243c ch\341\273\215n.",
+        "Kh\303\264ng c\303\263 danh m\341\273\245c ph\303\271 h\341\273\243p.",
+        "Kh\303\264ng c\303\263 m\341\273\245c l\303\243i \304\221\341\273\203 x\303\263a.",
+        "Kh\303\264ng c\303\263 t\341\273\207p l\306\260u \304\221\341\273\203 x\303\263a ho\341\272\267c x\303\263a th\341\272\245t b\341\272\241i (c\303\263 th\341\273\203 kh\303\264ng t\341\273\223n t\341\272\241i).\n",
+        "Kh\303\264ng ch\341\273\215n g\303\254.",
+        "Kh\303\264ng c\303\263 lo\341\272\241i h\341\273\243p l\341\273\207 \304\221\306\260\341\273\243c ch\341\273\215n.",
+        "H\341\273\247y nuke.\n",
+        "B\341\272\241n c\303\263 ch\341\272\257c mu\341\273\221n x\303\263a m\341\273\215i th\341\273\251 kh\303\264ng? (M\341\273\215i d\341\273\257 li\341\273\207u s\341\272\275 tr\341\273\237 v\341\273\201 tr\341\272\241ng th\303\241i ban \304\221\341\272\247u) [y/N]:",
+        "(n) Nuke ch\306\260\306\241ng tr\303\254nh (\304\221\341\272\267t l\341\272\241i v\303\240 x\303\263a file l\306\260u)",
+        "Ch\306\260\306\241ng tr\303\254nh \304\221\303\243 \304\221\306\260\341\273\243c nuke: tr\341\272\243 v\341\273\201 tr\341\272\241ng th\303\241i ban \304\221\341\272\247u.\n",
+        "S\341\273\221 ngo\303\240i ph\341\272\241m vi.",
+        "OFF",
+        "ON",
+        "Vui l\303\262ng tr\341\272\243 l\341\273\235i 'c' \304\221\341\273\203 t\341\272\241o ho\341\272\267c 'r' \304\221\341\273\203 nh\341\272\255p l\341\272\241i.",
+        "Vui l\303\262ng tr\341\272\243 l\341\273\235i 's' \304\221\341\273\203 thi\341\272\277t l\341\272\255p ho\341\272\267c 'r' \304\221\341\273\203 th\341\273\255 l\341\272\241i.",
+        "Nh\341\272\245n Enter \304\221\341\273\203 quay l\341\272\241i menu ch\303\255nh.\n",
+        "\304\220\303\243 x\341\273\255 l\303\275 l\341\273\213ch.",
+        "S\341\273\221 ti\341\273\201n (d\306\260\306\241ng = thu nh\341\272\255p, \303\242m = chi ti\303\252u):",
+        "S\341\273\221 ti\341\273\201n (d\306\260\306\241ng = thu nh\341\272\255p \304\221\341\273\213nh k\341\273\263, \303\242m = chi ti\303\252u \304\221\341\273\213nh k\341\273\263):",
+        "Lo\341\272\241i (t\303\252n ho\341\272\267c s\341\273\221) [tr\341\273\221ng = Auto-allocate]:",
+        "Nh\341\272\255p lo\341\272\241i ho\341\272\267c s\341\273\221 c\341\273\247a n\303\263, ho\341\272\267c \304\221\341\273\203 tr\341\273\221ng \304\221\341\273\203 t\341\273\261 \304\221\341\273\231ng ph\303\242n b\341\273\225 (cho thu nh\341\272\255p).",
+        "T\303\252n lo\341\272\241i (tr\341\273\221ng = ho\303\240n t\341\272\245t):",
+        "Ng\303\240y (YYYY-MM-DD) [tr\341\273\221ng = h\303\264m nay]:",
+        "Nh\341\272\255p ng\303\240y trong th\303\241ng (1-31):",
+        "Ch\341\273\215n lo\341\272\241i(ho\341\272\267c c\303\241c lo\341\272\241i) \303\241p d\341\273\245ng l\303\243i (s\341\273\221 c\303\241ch nhau b\341\273\237i d\341\272\245u ph\341\272\251y, ho\341\272\267c t\303\252n c\303\241ch nhau d\341\272\245u ph\341\272\251y):",
+        "Nh\341\272\255p l\303\243i (v\303\255 d\341\273\245 '0.5%', '0,5', '5.5', '5,5%'):",
+        "Nh\341\272\255p kho\341\272\243ng ng\303\240y:",
+        "Ghi ch\303\272:",
+        "B\341\272\241n c\303\263 mu\341\273\221n thi\341\272\277t l\341\272\255p ph\341\272\247n tr\304\203m ph\303\242n b\341\273\225 ngay kh\303\264ng? (s = thi\341\272\277t l\341\272\255p, l = \304\221\341\273\203 sau) [s/l]:",
+        "\304\220\303\243 th\303\252m {COUNT} giao d\341\273\213ch.",
+        "M\341\273\231t s\341\273\221 d\303\262ng b\341\273\213 l\341\273\227i. V\341\272\253n th\303\252m {COUNT} giao d\341\273\213ch h\341\273\243p l\341\273\207? (y/n):",
+        "Nh\341\272\255p nhanh: m\341\273\227i d\303\262ng m\341\273\231t giao d\341\273\213ch theo d\341\272\241ng NG\303\200Y S\341\273\220_TI\341\273\200N DANH_M\341\273\244C [GHI_CH\303\232].\nNG\303\200Y l\303\240 YYYY-MM-DD ho\341\272\267c \"today\"; DANH_M\341\273\244C \"auto\" t\341\273\261 \304\221\341\273\231ng ph\303\242n b\341\273\225 thu nh\341\272\255p; \304\221\341\272\267t t\303\252n c\303\263 d\341\272\245u c\303\241ch trong ngo\341\272\267c k\303\251p.\nD\303\241n bao nhi\303\252u d\303\262ng t\303\271y \303\275, sau \304\221\303\263 k\341\272\277t th\303\272c b\341\272\261ng m\341\273\231t d\303\262ng tr\341\273\221ng:",
+        "D\303\262ng {LINE}:",
+        "Kh\303\264ng c\303\263 giao d\341\273\213ch n\303\240o \304\221\306\260\341\273\243c th\303\252m.",
+        "\304\220ang th\341\273\255 t\341\272\243i l\341\272\241i...",
+        "\304\220\303\243 x\303\263a t\341\273\207p l\306\260u.",
+        "\304\220\303\243 l\306\260u. Tho\303\241t.",
+        "\nNh\341\272\245n Enter \304\221\341\273\203 quay l\341\272\241i giao di\341\273\207n ch\303\255nh ho\341\272\267c (s) l\306\260u v\303\240 tho\303\241t:",
+        "\304\220\303\243 l\306\260u v\303\240o",
+        "\304\220ang l\306\260u \341\273\237 ch\341\272\277 \304\221\341\273\231 n\341\273\201n; b\341\272\241n s\341\272\275 \304\221\306\260\341\273\243c th\303\264ng b\303\241o khi ho\303\240n t\341\272\245t.",
+        "Lo\341\272\241i: 1) M\341\273\227i X ng\303\240y  2) H\303\240ng th\303\241ng v\303\240o ng\303\240y D:",
+        "\304\220\303\243 th\303\252m l\341\273\213ch.",
+        "S\341\273\221 ngo\303\240i ph\341\272\241m vi cho l\341\273\261a ch\341\273\215n:",
+        "B\341\272\241n c\303\263 th\341\273\203 thi\341\272\277t l\341\272\255p ph\303\242n b\341\273\225 sau b\341\272\261ng m\341\273\245c 4.",
+        "Ho\303\240n t\341\272\245t thi\341\272\277t l\341\272\255p!",
+        "\n=== H\306\260\341\273\233ng d\341\272\253n b\341\272\257t \304\221\341\272\247u ===\n",
+        "V\341\272\253n kh\303\264ng t\303\254m th\341\272\245y t\341\273\207p l\306\260u. B\341\272\241n c\303\263 th\341\273\203 \304\221\341\272\267t '{SAVE_FILENAME}' v\303\240o th\306\260 m\341\273\245c l\303\240m vi\341\273\207c v\303\240 ch\341\273\215n (r) l\341\272\241i, ho\341\272\267c ch\341\273\215n (s) \304\221\341\273\203 thi\341\272\277t l\341\272\255p m\341\273\233i.",
+        "Th\303\252m giao d\341\273\213ch",
+        "Th\303\252m (NG\303\200Y S\341\273\220_TI\341\273\200N DANH_M\341\273\244C [GHI_CH\303\232]; Enter: xong, Esc: h\341\273\247y):",
+        "Ph\303\242n b\341\273\225 %",
+        "S\341\273\221 ti\341\273\201n",
+        "S\341\273\221 d\306\260",
+        "Danh m\341\273\245c",
+        "Ng\303\240y",
+        "Ghi ch\303\272",
+        "Quy t\341\272\257c l\303\243i: {COUNT}",
+        "1/2/Tab: \304\221\341\273\225i m\303\240n h\303\254nh   L\303\252n/Xu\341\273\221ng PgUp/PgDn Home/End: cu\341\273\231n   a: th\303\252m   r: l\341\273\213ch   p: x\341\273\255 l\303\275   s: l\306\260u   q: tho\303\241t",
+        "X\341\273\255 l\303\275 \304\221\341\272\277n h\341\272\241n",
+        "\304\220\303\243 x\341\273\255 l\303\275 l\341\273\213ch v\303\240 l\303\243i \304\221\341\272\277n h\341\272\241n: {COUNT} giao d\341\273\213ch m\341\273\233i.",
+        "Tho\303\241t",
+        "L\306\260u",
+        "Th\303\252m l\341\273\213ch",
+        "L\341\273\213ch: {COUNT}",
+        "L\341\273\213ch (every|monthly THAM_S\341\273\220 S\341\273\220_TI\341\273\200N B\341\272\256T_\304\220\341\272\246U DANH_M\341\273\244C [GHI_CH\303\232]):",
+        "T\341\273\225ng quan",
+        "T\341\273\225ng s\341\273\221 d\306\260: {TOTAL}",
+        "Giao d\341\273\213ch",
+        "Giao d\341\273\213ch: {COUNT}",
+        "L\341\273\261a ch\341\273\215n kh\303\264ng h\341\273\243p l\341\273\207.",
+    },
+};
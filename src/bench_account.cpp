@@ -0,0 +1,368 @@
+// Finance Manager v3.0 - Account engine microbenchmarks
+//
+// Times the engine's core functions in isolation: each case runs its warm-up
+// passes, then a fixed number of timed repetitions, and reports min, median,
+// mean, standard deviation and p90 per operation. A table goes to stderr and
+// JSON to stdout (or --json FILE), so results can be kept per release and
+// compared for regressions.
+//
+// Build: g++ -std=c++17 -O2 -DNDEBUG src/bench_account.cpp -o bin/bench_account
+// Usage: bin/bench_account [--reps N] [--warmup N] [--rows N] [--filter TEXT] [--json FILE]
+//        bin/bench_account --scaling [--max-rows N] [--csv FILE]
+//
+// --scaling sweeps input sizes instead (transactions, categories, interest
+// entries, years of catch-up), writes time-vs-N as CSV and fits the growth
+// exponent of each operation, flagging super-linear ones (see runScaling).
+//
+// The engine is compiled in from finance_v3_0.cpp (without its main), so the
+// benchmarks call exactly what the application runs. Fixtures come from
+// writeSyntheticSave (--gen-save) with a fixed seed and end date.
+
+#define FINANCE_NO_MAIN
+// The application's command handlers are compiled in but not called here
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "finance_v3_0.cpp"
+#pragma GCC diagnostic pop
+#ifdef _WIN32
+#include <process.h>   // _getpid
+#endif
+
+namespace {
+
+// One benchmark: setup (untimed) prepares a repetition, run (timed) performs
+// opsPerRun operations
+struct BenchCase {
+    const char *name;
+    uint64_t opsPerRun;
+    std::function<void()> setup;
+    std::function<void()> run;
+};
+
+struct BenchResult {
+    string name;
+    uint64_t opsPerRun = 0;
+    int reps = 0;
+    double minNs = 0, medianNs = 0, meanNs = 0, stddevNs = 0, p90Ns = 0;   // per operation
+};
+
+struct BenchOptions {
+    int reps = 30;
+    int warmup = 3;
+    uint64_t rows = 10000;
+    string filter;
+    string jsonPath;
+    string csvPath;    // --scaling
+};
+
+BenchResult runCase(const BenchCase &c, const BenchOptions &o) {
+    using clk = chrono::steady_clock;
+    vector<double> samples;
+    for (int i = 0; i < o.warmup + o.reps; ++i) {
+        if (c.setup) c.setup();
+        const auto t0 = clk::now();
+        c.run();
+        const double ns = chrono::duration<double, nano>(clk::now() - t0).count() / (double)c.opsPerRun;
+        if (i >= o.warmup) samples.push_back(ns);
+    }
+    sort(samples.begin(), samples.end());
+    BenchResult r;
+    r.name = c.name;
+    r.opsPerRun = c.opsPerRun;
+    r.reps = (int)samples.size();
+    r.minNs = samples.front();
+    r.medianNs = samples.size() % 2 ? samples[samples.size() / 2]
+                                    : (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) / 2.0;
+    r.p90Ns = samples[min(samples.size() - 1, (size_t)(0.9 * (double)(samples.size() - 1) + 0.5))];
+    for (double v : samples) r.meanNs += v;
+    r.meanNs /= (double)samples.size();
+    for (double v : samples) r.stddevNs += (v - r.meanNs) * (v - r.meanNs);
+    r.stddevNs = samples.size() > 1 ? sqrt(r.stddevNs / (double)(samples.size() - 1)) : 0.0;
+    return r;
+}
+
+// Benchmarks expect the project root as working directory (locales, data/);
+// look above the working directory, then above the executable
+void enterProjectRoot() {
+    std::error_code ec;
+    for (std::filesystem::path start : {std::filesystem::current_path(ec), std::filesystem::path(getExecutableDir())}) {
+        for (auto p = start; !p.empty(); p = p.parent_path()) {
+            if (std::filesystem::is_directory(p / "config" / "locales", ec)) { std::filesystem::current_path(p, ec); return; }
+            if (p == p.parent_path()) break;
+        }
+    }
+}
+
+string formatNs(double ns) {
+    char buf[32];
+    if (ns >= 1e6) snprintf(buf, sizeof buf, "%.3f ms", ns / 1e6);
+    else if (ns >= 1e3) snprintf(buf, sizeof buf, "%.3f us", ns / 1e3);
+    else snprintf(buf, sizeof buf, "%.1f ns", ns);
+    return buf;
+}
+
+string resultsJson(const vector<BenchResult> &results, const BenchOptions &o) {
+    string out = "{\"suite\":\"bench_account\",\"compiler\":";
+    jsonAppendString(out, __VERSION__);
+#ifdef FINANCE_STATS
+    out += ",\"instrumented\":true";
+#else
+    out += ",\"instrumented\":false";
+#endif
+    out += ",\"rows\":" + to_string(o.rows) + ",\"reps\":" + to_string(o.reps) + ",\"warmup\":" + to_string(o.warmup);
+    out += ",\"results\":[";
+    char num[256];
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult &r = results[i];
+        if (i) out += ',';
+        out += "{\"name\":";
+        jsonAppendString(out, r.name);
+        snprintf(num, sizeof num,
+                 ",\"ops_per_run\":%llu,\"reps\":%d,\"min_ns\":%.1f,\"median_ns\":%.1f,\"mean_ns\":%.1f,\"stddev_ns\":%.1f,\"p90_ns\":%.1f}",
+                 (unsigned long long)r.opsPerRun, r.reps, r.minNs, r.medianNs, r.meanNs, r.stddevNs, r.p90Ns);
+        out += num;
+    }
+    out += "]}\n";
+    return out;
+}
+
+// Tags the fixture files, so concurrent runs do not share them
+int processId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return (int)::getpid();
+#endif
+}
+
+// Engine benchmarks over a generated save file. The engine operations work
+// on a copy of base, restored by the untimed setup before every repetition.
+struct EngineFixture {
+    string savePath = (std::filesystem::temp_directory_path() / ("finance_bench_" + to_string(processId()) + ".txt")).string();
+    string outPath = savePath + ".out";
+    Account base, acc;
+    chrono_tp upTo;
+
+    bool load(const GenSaveOptions &gen) {
+        if (!writeSyntheticSave(savePath, gen)) return false;
+        upTo = gen.end;
+        SaveFileLock fileLock(savePath);
+        if (!base.loadFromFileLocked(savePath, false)) { cerr << "bench: cannot load fixture " << savePath << "\n"; return false; }
+        return true;
+    }
+
+    vector<BenchCase> cases() {
+        return {
+            {"loadFromFile", 1, nullptr, [this] {
+                SaveFileLock fileLock(savePath);
+                acc.loadFromFileLocked(savePath, false);
+            }},
+            // A fresh account each time: the save is not compared with an earlier one
+            {"saveToFile", 1, [this] { acc = base; acc.fileSync = SaveFileSync(); }, [this] { acc.saveToFile(outPath, false); }},
+            {"processSchedulesUpTo", 1, [this] { acc = base; }, [this] { acc.processSchedulesUpTo(upTo); }},
+            {"applyInterestUpTo", 1, [this] { acc = base; }, [this] { acc.applyInterestUpTo(upTo); }},
+            {"allocateAmount", 1000, [this] { acc = Account(); acc.allocationPct = base.allocationPct; acc.displayNames = base.displayNames; },
+             [this] { for (int i = 0; i < 1000; ++i) acc.allocateAmount(upTo, 100.0 + i, "bench"); }},
+        };
+    }
+
+    ~EngineFixture() {
+        std::error_code ec;
+        for (auto &f : {savePath, outPath}) {
+            std::filesystem::remove(f, ec);
+            std::filesystem::remove(checkpointPath(f), ec);
+            std::filesystem::remove(f + ".lock", ec);
+        }
+    }
+};
+
+// Base fixture: a year of pending schedules and interest on o.rows transactions
+GenSaveOptions fixtureOptions(uint64_t rows) {
+    GenSaveOptions gen;
+    gen.rows = rows;
+    gen.schedules = 8;
+    gen.interest = 3;
+    gen.seed = 42;
+    tryParseDate("2026-01-01", gen.end);
+    return gen;
+}
+
+// ---- Scaling curves (--scaling) ----
+// Each dimension grows one input by doubling and times the operations it
+// should affect (median of the repetitions). The exponent k of time ~ N^k is
+// the least-squares slope over log(N) vs log(time): about 0 for constant,
+// 1 for linear, 2 for quadratic. k above kSuperLinear is flagged.
+struct ScalingDimension {
+    const char *name;
+    vector<uint64_t> sizes;
+    std::function<void(GenSaveOptions &, uint64_t)> apply;
+    vector<string> operations;
+};
+
+constexpr double kSuperLinear = 1.3;
+
+double fitExponent(const vector<pair<double, double>> &points) {
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    const double n = (double)points.size();
+    for (auto &p : points) {
+        const double x = log(p.first), y = log(max(p.second, 1.0));
+        sx += x; sy += y; sxx += x * x; sxy += x * y;
+    }
+    const double den = n * sxx - sx * sx;
+    return den > 0 ? (n * sxy - sx * sy) / den : 0.0;
+}
+
+int runScaling(const BenchOptions &o, uint64_t maxRows) {
+    auto doubling = [](uint64_t from, uint64_t to) {
+        vector<uint64_t> v;
+        for (uint64_t n = from; n <= to; n *= 2) v.push_back(n);
+        return v;
+    };
+    const vector<ScalingDimension> dims = {
+        {"transactions", doubling(1000, maxRows), [](GenSaveOptions &g, uint64_t n) { g.rows = n; },
+         {"loadFromFile", "saveToFile", "processSchedulesUpTo", "applyInterestUpTo"}},
+        {"categories", doubling(4, 256), [](GenSaveOptions &g, uint64_t n) { g.categories = (int)n; },
+         {"loadFromFile", "saveToFile", "applyInterestUpTo", "allocateAmount"}},
+        {"interest entries", doubling(1, 32), [](GenSaveOptions &g, uint64_t n) { g.categories = max(g.categories, (int)n); g.interest = (int)n; },
+         {"applyInterestUpTo"}},
+        // Years never processed, with the history growing along (500 rows a month)
+        {"catch-up years", doubling(1, 8), [](GenSaveOptions &g, uint64_t n) {
+             g.years = (int)n; g.catchupMonths = 12 * (int)n; g.rows = 6000 * n; },
+         {"loadFromFile", "processSchedulesUpTo", "applyInterestUpTo"}},
+    };
+
+    ofstream csvFile;
+    if (!o.csvPath.empty()) {
+        csvFile.open(o.csvPath, ios::out | ios::trunc | ios::binary);
+        if (!csvFile) { cerr << "bench: cannot write " << o.csvPath << "\n"; return 1; }
+    }
+    std::ostream &csv = o.csvPath.empty() ? cout : csvFile;
+    csv << "dimension,operation,n,median_ns,min_ns\n";
+
+    struct Fit { string dim, op; double k; size_t points; };
+    vector<Fit> fits;
+    for (auto &d : dims) {
+        map<string, vector<pair<double, double>>> curves;
+        for (uint64_t n : d.sizes) {
+            GenSaveOptions gen = fixtureOptions(10000);
+            d.apply(gen, n);
+            EngineFixture fx;
+            if (!fx.load(gen)) return 1;
+            for (auto &c : fx.cases()) {
+                if (find(d.operations.begin(), d.operations.end(), c.name) == d.operations.end()) continue;
+                if (!o.filter.empty() && string(c.name).find(o.filter) == string::npos) continue;
+                const BenchResult r = runCase(c, o);
+                csv << d.name << "," << r.name << "," << n << "," << fixed << setprecision(1) << r.medianNs << "," << r.minNs << "\n";
+                curves[r.name].push_back({(double)n, r.medianNs});
+            }
+            cerr << "  " << d.name << " = " << n << " done\n";
+        }
+        for (auto &c : curves) fits.push_back({d.name, c.first, fitExponent(c.second), c.second.size()});
+    }
+
+    cerr << "\n" << left << setw(18) << "dimension" << setw(22) << "operation" << right << setw(8) << "k" << "  fit\n";
+    for (auto &f : fits) {
+        const char *label = f.k < 0.3 ? "~ constant" : f.k < kSuperLinear ? "~ linear" : "SUPER-LINEAR";
+        cerr << left << setw(18) << f.dim << setw(22) << f.op << right << fixed << setprecision(2) << setw(8) << f.k
+             << "  " << label << (f.points < 3 ? " (too few points)" : "") << "\n";
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    BenchOptions o;
+    bool scaling = false;
+    uint64_t maxRows = 64000;
+    // Output paths are relative to the caller's directory; enterProjectRoot changes it
+    auto outputPath = [](const char *path) {
+        std::error_code ec;
+        const auto abs = std::filesystem::absolute(path, ec);
+        return ec ? string(path) : abs.string();
+    };
+    for (int i = 1; i < argc; ++i) {
+        const string a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        try {
+            if (a == "--reps" && hasValue) o.reps = stoi(argv[++i]);
+            else if (a == "--warmup" && hasValue) o.warmup = stoi(argv[++i]);
+            else if (a == "--rows" && hasValue) o.rows = stoull(argv[++i]);
+            else if (a == "--filter" && hasValue) o.filter = argv[++i];
+            else if (a == "--json" && hasValue) o.jsonPath = outputPath(argv[++i]);
+            else if (a == "--scaling") scaling = true;
+            else if (a == "--csv" && hasValue) o.csvPath = outputPath(argv[++i]);
+            else if (a == "--max-rows" && hasValue) maxRows = stoull(argv[++i]);
+            else o.reps = 0;
+        } catch (...) { o.reps = 0; }
+    }
+    if (o.reps <= 0 || o.warmup < 0 || o.rows == 0 || maxRows < 1000) {
+        cerr << "usage: bench_account [--reps N] [--warmup N] [--rows N] [--filter TEXT] [--json FILE]\n"
+                "       bench_account --scaling [--max-rows N] [--reps N] [--warmup N] [--filter TEXT] [--csv FILE]\n";
+        return 1;
+    }
+    enterProjectRoot();
+    if (scaling) {
+        if (o.reps == BenchOptions().reps) o.reps = 5;   // many fixtures: fewer repetitions each
+        return runScaling(o, maxRows);
+    }
+
+    EngineFixture fx;
+    if (!fx.load(fixtureOptions(o.rows))) return 1;
+    const Account &base = fx.base;
+
+    // Inputs for the helpers, cycled so every call sees different data
+    vector<string> dates, lines, names;
+    for (size_t i = 0; i < 256 && i < base.txs.size(); ++i) {
+        const Transaction &t = base.txs[i * base.txs.size() / 256];
+        dates.push_back(toDateString(t.date));
+        std::ostringstream os;
+        os << escapeForSave(toDateString(t.date)) << "|" << t.amount << "|" << escapeForSave(t.category) << "|" << escapeForSave(t.note);
+        lines.push_back(os.str());
+        names.push_back("  " + t.category + " ");
+    }
+    const string lang = "VI";
+    vector<string> msgIds;
+    for (size_t i = 0; i < kMsgCount; ++i) msgIds.emplace_back(kMsgIds[i]);
+    i18n.get(lang, msgIds[0]);   // discover and load the locales before anything is timed
+
+    volatile size_t sink = 0;   // keeps the helper loops from being optimized away
+    chrono_tp parsed;
+    const uint64_t kMicroOps = 10000;
+    vector<BenchCase> cases = fx.cases();
+    const vector<BenchCase> helpers = {
+        {"tryParseDate", kMicroOps, nullptr, [&] {
+            for (uint64_t i = 0; i < kMicroOps; ++i) sink = sink + tryParseDate(dates[i % dates.size()], parsed);
+        }},
+        {"splitEscaped", kMicroOps, nullptr, [&] {
+            for (uint64_t i = 0; i < kMicroOps; ++i) sink = sink + splitEscaped(lines[i % lines.size()]).size();
+        }},
+        {"normalizeKey", kMicroOps, nullptr, [&] {
+            for (uint64_t i = 0; i < kMicroOps; ++i) sink = sink + normalizeKey(names[i % names.size()]).size();
+        }},
+        {"I18n::get", kMicroOps, nullptr, [&] {
+            for (uint64_t i = 0; i < kMicroOps; ++i) sink = sink + i18n.get(lang, msgIds[i % msgIds.size()]).size();
+        }},
+    };
+    cases.insert(cases.end(), helpers.begin(), helpers.end());
+
+    vector<BenchResult> results;
+    cerr << left << setw(22) << "benchmark" << right << setw(14) << "min" << setw(14) << "median" << setw(14) << "mean"
+         << setw(14) << "stddev" << setw(14) << "p90" << "\n";
+    for (auto &c : cases) {
+        if (!o.filter.empty() && string(c.name).find(o.filter) == string::npos) continue;
+        results.push_back(runCase(c, o));
+        const BenchResult &r = results.back();
+        cerr << left << setw(22) << r.name << right << setw(14) << formatNs(r.minNs) << setw(14) << formatNs(r.medianNs)
+             << setw(14) << formatNs(r.meanNs) << setw(14) << formatNs(r.stddevNs) << setw(14) << formatNs(r.p90Ns) << "\n";
+    }
+
+    const string json = resultsJson(results, o);
+    if (o.jsonPath.empty()) cout << json;
+    else {
+        ofstream ofs(o.jsonPath, ios::out | ios::trunc | ios::binary);
+        ofs << json;
+        if (!ofs) { cerr << "bench: cannot write " << o.jsonPath << "\n"; return 1; }
+    }
+    return 0;
+}
@@ -0,0 +1,475 @@
+// Finance Manager - cross-version performance comparison
+//
+// Builds every src/finance_v*.cpp (or the versions named on the command
+// line) and drives the same interactive session through each one: first-run
+// setup, a recurring schedule, N manual transactions, processing schedules,
+// adding and applying interest, saving and reloading. Each version runs in
+// its own scratch project (copy of config/ and of its source file, empty
+// data/save/) and is measured
+// from outside: wall time per phase and in total, CPU time and peak RSS of the
+// process (wait4), and the size of the save file it leaves behind. Comparing
+// consecutive versions shows which release introduced a slowdown.
+// Versions v2_4 to v2_8 find their save file relative to __FILE__, so each one
+// is compiled from its copy in the scratch project; a version that still
+// changes anything under the project's data/ is reported as failed.
+//
+// Build: g++ -std=c++17 -O2 -DNDEBUG src/bench_versions.cpp -o bin/bench_versions
+// Usage: bin/bench_versions [--adds N] [--csv FILE] [--cxx COMPILER | --prebuilt DIR] [--keep] [VERSION ...]
+//        (VERSION as in the file name, e.g. v2_9; run from the project root)
+//
+// The versions' menus and prompts differ, so the session is not a fixed
+// stdin script: the driver reads each prompt and answers it from a table of
+// prompt texts (see SessionDriver::answer), and picks menu entries by their
+// label. A prompt it does not know stops that version with the transcript
+// tail, rather than feeding input to the wrong question. POSIX only.
+
+#include <bits/stdc++.h>
+#include <filesystem>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+namespace fs = std::filesystem;
+
+#ifndef _WIN32
+namespace {
+
+using clk = chrono::steady_clock;
+
+// Session plan, in order. Adds repeat opts.adds times.
+enum class Step { Setup, Schedule, Add, Process, Interest, ApplyInterest, Save, Reload, Exit, Done };
+const char *const kPhaseNames[] = {"setup", "schedule", "adds", "process", "interest", "apply interest", "save", "reload", "exit"};
+constexpr size_t kPhaseCount = sizeof kPhaseNames / sizeof *kPhaseNames;
+
+struct RunResult {
+    string version;
+    string status = "ok";
+    double wallMs = 0, cpuMs = 0;
+    long peakRssKb = 0;
+    uintmax_t saveBytes = 0;
+    size_t saveRows = 0;
+    array<double, kPhaseCount> phaseMs{};
+};
+
+struct Options {
+    int adds = 10000;
+    string csvPath;
+    string cxx = "g++";
+    string prebuilt;   // directory with finance_vX_Y executables to use instead of building
+    bool keep = false;
+    vector<string> versions;
+};
+
+// Remove terminal control sequences (colors, clear screen, alternate screen)
+string stripAnsi(const string &s) {
+    string out;
+    out.reserve(s.size());
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (s[i] == '\r') continue;
+        if (s[i] != '\x1b') { out.push_back(s[i]); continue; }
+        if (i + 1 < s.size() && s[i + 1] == '[') {
+            i += 2;
+            while (i < s.size() && !(s[i] >= '@' && s[i] <= '~')) ++i;
+        } else ++i;
+    }
+    return out;
+}
+
+string lastLine(const string &s) {
+    size_t end = s.find_last_not_of(" \t\n");
+    if (end == string::npos) return string();
+    size_t start = s.rfind('\n', end);
+    return s.substr(start == string::npos ? 0 : start + 1, end + 1 - (start == string::npos ? 0 : start + 1));
+}
+
+bool contains(const string &s, const char *needle) { return s.find(needle) != string::npos; }
+
+// Menu entries "N) label" seen in the text; the number of the last one whose label contains any needle
+int menuNumber(const string &menu, std::initializer_list<const char *> needles) {
+    int found = -1;
+    std::istringstream is(menu);
+    string line;
+    while (getline(is, line)) {
+        size_t p = line.find_first_not_of(' ');
+        if (p == string::npos || !isdigit((unsigned char)line[p])) continue;
+        size_t close = line.find(')', p);
+        if (close == string::npos) continue;
+        const string label = line.substr(close + 1);
+        for (const char *n : needles) if (contains(label, n)) { found = atoi(line.c_str() + p); break; }
+    }
+    return found;
+}
+
+// Answers one version's prompts according to the session plan
+class SessionDriver {
+public:
+    SessionDriver(const Options &o) : opts(o) {}
+
+    Step step = Step::Setup;
+    int added = 0;
+    string error;
+
+    // Reply to the prompt at the end of text (output since the last reply);
+    // false if text does not end with a prompt we know
+    bool answer(const string &text, string &reply) {
+        const string line = lastLine(text);
+        if (line.empty()) return false;
+        const char tail = line.back();
+        if (tail != ':' && tail != '?' && tail != '>' && tail != ']' && tail != ')') return false;
+
+        // Main menu: start the next step
+        if (line == "Choice:" && menuNumber(text, {"Add manual"}) > 0) {
+            menu = text;
+            return startNextStep(reply);
+        }
+        // First run
+        if (contains(line, "(s)et up new account")) { reply = "s"; return true; }
+        if (contains(line, "Category name (empty = finish)")) {
+            reply = setupCategories < 2 ? (setupCategories == 0 ? "Food" : "Saving") : "";
+            ++setupCategories;
+            return true;
+        }
+        if (contains(line, "set allocation percentages now")) { reply = "s"; return true; }
+        if (contains(line, "Category percent>") || contains(line, "enter new percent")) return allocationReply(line, reply);
+        if (contains(line, "Select language") || contains(line, "Choose language")) { reply = "EN"; return true; }
+
+        // Transaction and schedule fields
+        if (contains(line, "Date (YYYY-MM-DD)")) { reply = addDate(); return true; }
+        if (contains(line, "Start date (YYYY-MM-DD)")) { reply = "2024-01-05"; return true; }
+        if (contains(line, "Every X days") || (line == "Choice:" && contains(text, "Every X days"))) { reply = "2"; return true; }
+        if (contains(line, "Enter day of month")) { reply = "5"; return true; }
+        if (contains(line, "Amount (positive for scheduled")) { reply = "-40"; return true; }
+        if (contains(line, "Amount (positive")) { reply = step == Step::Schedule ? "-40" : addAmount(); return true; }
+        if (contains(line, "Amount")) { reply = step == Step::Schedule ? "-40" : addAmount(); return true; }
+        if (contains(line, "Category (name or number)") || contains(line, "Retype category") || contains(line, "Category or blank")
+            || line == "Category:") {
+            reply = step == Step::Schedule ? "Food" : addCategory();
+            return true;
+        }
+        if (contains(line, "or retype? (c/r)")) { reply = "c"; return true; }
+        if (contains(line, "Note:")) { reply = step == Step::Schedule ? "rent" : "bench " + to_string(added); return true; }
+        if (contains(line, "Auto-allocate")) { reply = "n"; return true; }
+
+        // Interest: v1 asks for one rate, later versions have an interest menu
+        if (contains(line, "Saving annual interest rate")) { reply = "3"; return true; }
+        if (contains(line, "Interest menu")) { reply = step == Step::Interest ? "a" : "p"; return true; }
+        if (contains(line, "apply interest rate") || contains(line, "to apply interest") || contains(line, "Enter category display name")) {
+            reply = "Saving";
+            return true;
+        }
+        if (contains(line, "Enter rate") || contains(line, "Enter interest")) { reply = "3"; return true; }
+        if (contains(line, "(M)onthly or (A)nnually") || contains(line, "(A) annually")
+            || contains(line, "(a) annual")) {
+            reply = "a";
+            return true;
+        }
+        if (contains(line, "interest rate is applied since")) { reply = "2024-01-01"; return true; }
+
+        // Returning to the menu and exiting
+        if (contains(line, "Return to Main Interface")) { reply = "y"; return true; }
+        if (contains(line, "Enter to return to Main Interface")) { reply = ""; return true; }
+        if (contains(line, "save before exit") || contains(line, "Save before exit") || contains(line, "unsaved")) {
+            reply = "n";
+            return true;
+        }
+        return false;
+    }
+
+    // Step that the phase clock should be charged to
+    size_t phase() const { return (size_t)min(step, Step::Exit); }
+
+private:
+    const Options &opts;
+    string menu;
+    int setupCategories = 0;
+    int allocations = 0;
+
+    bool startNextStep(string &reply) {
+        // Advance after the previous step returned to the menu
+        switch (step) {
+        case Step::Setup: step = Step::Schedule; break;
+        case Step::Schedule: step = opts.adds > 0 ? Step::Add : Step::Process; break;
+        case Step::Add: if (added >= opts.adds) step = Step::Process; break;
+        case Step::Process: step = Step::Interest; break;
+        case Step::Interest: step = Step::ApplyInterest; break;
+        case Step::ApplyInterest: step = Step::Save; break;
+        case Step::Save: step = Step::Reload; break;
+        case Step::Reload: step = Step::Exit; break;
+        default: break;
+        }
+        int n = -1;
+        switch (step) {
+        case Step::Schedule: n = menuNumber(menu, {"Add scheduled"}); break;
+        case Step::Add: n = menuNumber(menu, {"Add manual"}); ++added; break;
+        case Step::Process: n = menuNumber(menu, {"Process schedules"}); break;
+        case Step::Interest:
+        case Step::ApplyInterest: n = menuNumber(menu, {"interest"}); break;
+        case Step::Save: n = menuNumber(menu, {") Save", "Save"}); break;
+        case Step::Reload: n = menuNumber(menu, {"Load"}); break;
+        case Step::Exit: n = menuNumber(menu, {"Exit"}); break;
+        default: break;
+        }
+        // Versions with a single "apply interest" entry have nothing to add first
+        if (step == Step::Interest && !contains(menu, "interest")) n = -1;
+        if (n < 0) { error = "no menu entry for step " + to_string((int)step); return false; }
+        reply = to_string(n);
+        return true;
+    }
+
+    bool allocationReply(const string &line, string &reply) {
+        if (contains(line, "Category percent>")) {
+            static const char *const kLines[] = {"Saving 50", "Food 50", ""};
+            reply = kLines[min(allocations++, 2)];
+        } else {
+            reply = allocations++ < 2 ? "50" : "";   // one prompt per category, Other takes the rest
+        }
+        return true;
+    }
+
+    // Manual transactions: two years of dated expenses over two categories
+    string addDate() const {
+        const int day = (added * 7) % 730;
+        tm t{};
+        t.tm_year = 2024 - 1900; t.tm_mon = 0; t.tm_mday = 1 + day; t.tm_hour = 12;
+        mktime(&t);
+        char buf[16];
+        strftime(buf, sizeof buf, "%Y-%m-%d", &t);
+        return buf;
+    }
+    // Income into Saving (so interest has a balance to work on), expenses from Food
+    string addAmount() const { return (added % 2 ? "-" : "") + to_string(1 + added % 90) + ".25"; }
+    string addCategory() const { return added % 2 ? "Food" : "Saving"; }
+};
+
+// Size and modification time of every file under dir; empty if dir does not exist
+map<string, pair<uintmax_t, fs::file_time_type>> treeState(const fs::path &dir) {
+    map<string, pair<uintmax_t, fs::file_time_type>> state;
+    std::error_code ec;
+    if (!fs::exists(dir, ec)) return state;
+    state[dir.string()] = {0, fs::file_time_type{}};
+    for (auto it = fs::recursive_directory_iterator(dir, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        std::error_code fec;
+        const uintmax_t size = it->is_regular_file(fec) ? it->file_size(fec) : 0;
+        state[it->path().string()] = {size, it->last_write_time(fec)};
+    }
+    return state;
+}
+
+// Run one built version in its scratch project and drive the session
+RunResult runSession(const string &version, const fs::path &exe, const fs::path &work, const Options &opts) {
+    RunResult res;
+    res.version = version;
+    int toChild[2], fromChild[2];
+    if (pipe(toChild) != 0 || pipe(fromChild) != 0) { res.status = "pipe failed"; return res; }
+    const auto t0 = clk::now();
+    pid_t pid = fork();
+    if (pid == 0) {
+        dup2(toChild[0], 0);
+        dup2(fromChild[1], 1);
+        dup2(fromChild[1], 2);
+        close(toChild[1]); close(fromChild[0]);
+        if (chdir(work.c_str()) != 0) _exit(127);
+        setenv("TERM", "dumb", 1);
+        execl(exe.c_str(), exe.c_str(), (char *)nullptr);
+        _exit(127);
+    }
+    close(toChild[0]); close(fromChild[1]);
+    signal(SIGPIPE, SIG_IGN);
+
+    SessionDriver driver(opts);
+    string pending, transcript;
+    auto phaseStart = clk::now();
+    size_t phase = driver.phase();
+    char buf[65536];
+    bool failed = false;
+    while (true) {
+        pollfd pfd{fromChild[0], POLLIN, 0};
+        const int ready = poll(&pfd, 1, 10000);
+        if (ready == 0) {
+            res.status = driver.error.empty() ? "no known prompt" : driver.error;
+            failed = true;
+            break;
+        }
+        const ssize_t n = read(fromChild[0], buf, sizeof buf);
+        if (n <= 0) break;   // the program exited
+        const string chunk = stripAnsi(string(buf, (size_t)n));
+        pending += chunk;
+        transcript += chunk;
+        if (transcript.size() > 8192) transcript.erase(0, transcript.size() - 4096);
+        // More output already waiting: the prompt is not complete yet
+        pollfd more{fromChild[0], POLLIN, 0};
+        if (poll(&more, 1, 0) > 0) continue;
+        string reply;
+        if (!driver.answer(pending, reply)) {
+            if (!driver.error.empty()) { res.status = driver.error; failed = true; break; }
+            continue;   // wait for the rest of the prompt
+        }
+        if (driver.phase() != phase) {
+            const auto now = clk::now();
+            res.phaseMs[phase] += chrono::duration<double, milli>(now - phaseStart).count();
+            phaseStart = now;
+            phase = driver.phase();
+        }
+        pending.clear();
+        reply += '\n';
+        if (write(toChild[1], reply.data(), reply.size()) != (ssize_t)reply.size()) break;
+    }
+    close(toChild[1]);
+    if (failed) kill(pid, SIGKILL);
+    int status = 0;
+    rusage ru{};
+    wait4(pid, &status, 0, &ru);
+    close(fromChild[0]);
+    const auto end = clk::now();
+    res.phaseMs[phase] += chrono::duration<double, milli>(end - phaseStart).count();
+    res.wallMs = chrono::duration<double, milli>(end - t0).count();
+    res.cpuMs = (double)(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1e3 + (double)(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1e3;
+    res.peakRssKb = ru.ru_maxrss;
+    if (!failed && driver.step != Step::Exit) { res.status = "exited early"; failed = true; }
+    if (failed) {
+        cerr << version << ": " << res.status << "; last output:\n" << transcript.substr(transcript.size() > 600 ? transcript.size() - 600 : 0) << "\n";
+        return res;
+    }
+
+    // Older versions save next to the executable's working directory, newer ones under data/save
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(work, ec); it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        if (ec) break;
+        if (it->path().filename() != "finance_save.txt") continue;
+        res.saveBytes = fs::file_size(it->path(), ec);
+        ifstream ifs(it->path());
+        string line;
+        bool inTxs = false;
+        while (getline(ifs, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (inTxs && !line.empty()) ++res.saveRows;
+            if (line == "TXS") inTxs = true;
+        }
+        break;
+    }
+    if (res.saveRows < (size_t)opts.adds) res.status = "save has " + to_string(res.saveRows) + " rows";
+    return res;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+        const string a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        try {
+            if (a == "--adds" && hasValue) opts.adds = stoi(argv[++i]);
+            else if (a == "--csv" && hasValue) opts.csvPath = argv[++i];
+            else if (a == "--cxx" && hasValue) opts.cxx = argv[++i];
+            else if (a == "--prebuilt" && hasValue) opts.prebuilt = argv[++i];
+            else if (a == "--keep") opts.keep = true;
+            else if (a.rfind("--", 0) == 0) opts.adds = -1;
+            else opts.versions.push_back(a.rfind("finance_", 0) == 0 ? a.substr(8) : a);
+        } catch (...) { opts.adds = -1; }
+    }
+    if (opts.adds < 0) {
+        cerr << "usage: bench_versions [--adds N] [--csv FILE] [--cxx COMPILER | --prebuilt DIR] [--keep] [VERSION ...]\n";
+        return 1;
+    }
+    if (!fs::is_directory("src") || !fs::is_directory("config")) {
+        cerr << "bench_versions: run from the project root (needs src/ and config/)\n";
+        return 1;
+    }
+    if (opts.versions.empty()) {
+        for (auto &e : fs::directory_iterator("src")) {
+            const string name = e.path().stem().string();
+            if (e.path().extension() == ".cpp" && name.rfind("finance_v", 0) == 0) opts.versions.push_back(name.substr(8));
+        }
+    }
+    // v1_10 after v1_9
+    sort(opts.versions.begin(), opts.versions.end(), [](const string &a, const string &b) {
+        auto key = [](const string &v) { int major = 0, minor = 0; sscanf(v.c_str(), "v%d_%d", &major, &minor); return make_pair(major, minor); };
+        return key(a) < key(b);
+    });
+
+    const fs::path root = fs::current_path();
+    const fs::path scratch = fs::temp_directory_path() / ("finance_versions_" + to_string(getpid()));
+    // The sessions must stay inside their scratch projects
+    auto dataBefore = treeState(root / "data");
+    vector<RunResult> results;
+    for (const string &v : opts.versions) {
+        const fs::path original = root / "src" / ("finance_" + v + ".cpp");
+        const fs::path work = scratch / v;
+        const fs::path src = work / "src" / original.filename();
+        std::error_code ec;
+        fs::create_directories(work / "bin", ec);
+        fs::create_directories(work / "src", ec);
+        fs::create_directories(work / "data" / "save", ec);
+        fs::copy(root / "config", work / "config", fs::copy_options::recursive, ec);
+        fs::remove(work / "config" / "locales.bundle", ec);
+        const fs::path exe = work / "bin" / ("finance_" + v);
+        bool built = false;
+        if (!opts.prebuilt.empty()) {
+            built = fs::copy_file(fs::path(opts.prebuilt) / exe.filename(), exe, fs::copy_options::overwrite_existing, ec);
+        } else if (fs::exists(original)) {
+            // Build the copy: __FILE__ (save path of v2_4 to v2_8, locale fallback) then points into work
+            cerr << "building " << v << "...\n";
+            fs::copy_file(original, src, fs::copy_options::overwrite_existing, ec);
+            const string cmd = opts.cxx + " -std=c++17 -O2 -DNDEBUG -w '" + src.string() + "' -o '" + exe.string() + "'";
+            built = system(cmd.c_str()) == 0;
+        }
+        if (!built) {
+            RunResult r;
+            r.version = v;
+            r.status = "build failed";
+            results.push_back(r);
+            continue;
+        }
+        cerr << "running " << v << " (" << opts.adds << " adds)...\n";
+        results.push_back(runSession(v, exe, work, opts));
+        auto dataAfter = treeState(root / "data");
+        if (dataAfter != dataBefore) {
+            cerr << v << ": changed files under " << (root / "data").string() << "\n";
+            results.back().status = "touched project data/";
+            dataBefore = std::move(dataAfter);
+        }
+    }
+    if (!opts.keep) {
+        std::error_code ec;
+        fs::remove_all(scratch, ec);
+    }
+
+    cout << left << setw(8) << "version" << right << setw(10) << "wall ms" << setw(10) << "cpu ms" << setw(10) << "rss MB"
+         << setw(11) << "save KB" << setw(9) << "rows";
+    for (size_t p = 2; p < kPhaseCount - 1; ++p) cout << setw(18) << string(kPhaseNames[p]) + " ms";
+    cout << "  status\n";
+    for (auto &r : results) {
+        cout << left << setw(8) << r.version << right << fixed << setprecision(1) << setw(10) << r.wallMs << setw(10) << r.cpuMs
+             << setw(10) << (double)r.peakRssKb / 1024.0 << setw(11) << (double)r.saveBytes / 1024.0 << setw(9) << r.saveRows;
+        for (size_t p = 2; p < kPhaseCount - 1; ++p) cout << setw(18) << r.phaseMs[p];
+        cout << "  " << r.status << "\n";
+    }
+
+    if (!opts.csvPath.empty()) {
+        ofstream csv(opts.csvPath, ios::out | ios::trunc | ios::binary);
+        csv << "version,status,adds,wall_ms,cpu_ms,peak_rss_kb,save_bytes,save_rows";
+        for (auto *p : kPhaseNames) { string n = p; replace(n.begin(), n.end(), ' ', '_'); csv << "," << n << "_ms"; }
+        csv << "\n";
+        for (auto &r : results) {
+            csv << r.version << "," << r.status << "," << opts.adds << "," << fixed << setprecision(1) << r.wallMs << "," << r.cpuMs
+                << "," << r.peakRssKb << "," << r.saveBytes << "," << r.saveRows;
+            for (double ms : r.phaseMs) csv << "," << ms;
+            csv << "\n";
+        }
+        if (!csv) { cerr << "bench_versions: cannot write " << opts.csvPath << "\n"; return 1; }
+    }
+    return all_of(results.begin(), results.end(), [](const RunResult &r) { return r.status == "ok"; }) ? 0 : 1;
+}
+#else
+int main() {
+    cerr << "bench_versions: needs a POSIX system (fork, pipes, wait4)\n";
+    return 1;
+}
+#endif
@@ -19,6 +19,16 @@
 
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <poll.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <termios.h>
+#include <unistd.h>
 #endif
 
 #include <bits/stdc++.h>
@@ -69,8 +79,244 @@ struct Settings {
     string language = "EN"; // "EN", "VI", "DE", etc.
 };
 
-// Forward declaration for translation helper (defined later)
-static inline string tr(const Settings &s, const string &id);
+// Message ids and compiled translations (generated by --gen-catalog)
+#include "../config/messages_gen.h"
+
+// Forward declarations for translation helpers (defined later)
+static inline std::string_view tr(const Settings &s, Msg id);
+
+// ---- Instrumentation ----
+// FIN_PERF_SCOPE(op) times the rest of the enclosing block into gPerf[op]
+// (calls, total and max latency); FIN_PERF_ROWS(n) adds rows processed, and
+// FIN_PERF_SCOPE_TXS(op, txs) counts the rows appended to txs meanwhile.
+// Reading the clock costs more than a tr() call, so FIN_PERF_SAMPLED_SCOPE
+// times one call per thread in kPerfSampleEvery and counts it for all of them.
+// Counters are relaxed atomics, so any thread may update them; --stats
+// prints them at exit. Built in unless NDEBUG (release builds) or
+// FINANCE_NO_STATS is defined, in which case the macros expand to nothing
+// and their arguments are not evaluated. -DFINANCE_STATS forces them on.
+// -DFINANCE_ALLOC_STATS also hooks operator new (see AllocPhase) and implies it.
+#if !defined(FINANCE_STATS) && (defined(FINANCE_ALLOC_STATS) || (!defined(NDEBUG) && !defined(FINANCE_NO_STATS)))
+#define FINANCE_STATS 1
+#endif
+
+enum class PerfOp : uint8_t { LoadFromFile, SaveToFile, ProcessSchedules, ApplyInterest, AllocateAmount, Translate, Count };
+static constexpr const char *kPerfOpNames[] = {
+    "loadFromFile", "saveToFile", "processSchedulesUpTo", "applyInterestUpTo", "allocateAmount", "tr"
+};
+
+#ifdef FINANCE_STATS
+// ---- Heap allocation profile (--alloc-stats) ----
+// Built with -DFINANCE_ALLOC_STATS, the replaced global operator new counts
+// every allocation and its requested bytes against this thread's current
+// phase: the innermost FIN_PERF_SCOPE, FIN_PERF_SAMPLED_SCOPE (every call,
+// not just the timed ones) or FIN_TRACE_SCOPE, whether or not --trace is on.
+// Phases are string literals, so a fixed open-addressed table keyed by the
+// pointer needs no lock and no allocation of its own. Array and nothrow
+// forms reach these through their default definitions; over-aligned new is
+// not counted. Otherwise AllocPhase is empty and costs nothing.
+#ifdef FINANCE_ALLOC_STATS
+struct AllocCounter {
+    std::atomic<const char *> phase{nullptr};   // nullptr while the slot is free
+    std::atomic<uint64_t> allocs{0}, bytes{0};
+};
+static constexpr size_t kAllocSlots = 256;   // power of two, more than the distinct phase names
+static AllocCounter gAllocSlots[kAllocSlots];
+static AllocCounter gAllocOutside;           // no phase active, or the table is full
+static thread_local const char *tAllocPhase = nullptr;
+
+static inline void allocRecord(size_t bytes) {
+    AllocCounter *c = &gAllocOutside;
+    if (const char *phase = tAllocPhase) {
+        size_t i = (size_t)(((uint64_t)(uintptr_t)phase * 0x9E3779B97F4A7C15ull) >> 56) & (kAllocSlots - 1);
+        for (size_t probe = 0; probe < kAllocSlots; ++probe, i = (i + 1) & (kAllocSlots - 1)) {
+            const char *cur = gAllocSlots[i].phase.load(std::memory_order_relaxed);
+            if (!cur && gAllocSlots[i].phase.compare_exchange_strong(cur, phase, std::memory_order_relaxed)) cur = phase;
+            if (cur == phase) { c = &gAllocSlots[i]; break; }
+        }
+    }
+    c->allocs.fetch_add(1, std::memory_order_relaxed);
+    c->bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+// Makes name the current phase until destroyed; next() switches to a sibling
+class AllocPhase {
+public:
+    explicit AllocPhase(const char *name) : prev(tAllocPhase) { tAllocPhase = name; }
+    ~AllocPhase() { tAllocPhase = prev; }
+    void next(const char *name) { tAllocPhase = name; }
+    AllocPhase(const AllocPhase &) = delete;
+    AllocPhase &operator=(const AllocPhase &) = delete;
+private:
+    const char *prev;
+};
+
+void *operator new(std::size_t n) {
+    allocRecord(n);
+    for (;;) {
+        if (void *p = std::malloc(n ? n : 1)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+// Kept out of line: inlined, GCC sees free() meet a new-expression and warns
+#if defined(__GNUC__)
+__attribute__((noinline))
+#endif
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { ::operator delete(p); }
+#else
+struct AllocPhase {
+    explicit AllocPhase(const char *) {}
+    void next(const char *) {}
+};
+#endif
+
+// ---- Trace events (--trace FILE) ----
+// FIN_TRACE_SCOPE(name) records the rest of the block as one Chrome trace
+// event ("ph":"X"); FIN_TRACE_NEXT(name) closes it and starts the next phase
+// of the same block, and FIN_TRACE_SCOPE_DETAIL adds a short label (evaluated
+// only while tracing). FIN_PERF_SCOPE operations are traced too. Events go to
+// a ring per thread that only that thread writes, so recording takes no lock;
+// while tracing is off a scope costs one relaxed load. writeTraceFile dumps
+// the rings as JSON at exit, keeping the newest kTraceRingSize per thread.
+struct TraceEvent {
+    const char *name;              // string literal
+    uint64_t startNs, durNs;       // since gTraceStart
+    char detail[48];               // truncated label, e.g. schedule note or interest month
+};
+static constexpr size_t kTraceRingSize = 1 << 16;   // power of two
+
+struct TraceRing {
+    std::unique_ptr<TraceEvent[]> events{new TraceEvent[kTraceRingSize]};
+    std::atomic<uint64_t> head{0};   // events recorded so far
+    uint32_t tid = 0;
+    string threadName;
+};
+
+static std::atomic<bool> gTraceEnabled{false};
+static const std::chrono::steady_clock::time_point gTraceStart = std::chrono::steady_clock::now();
+static std::mutex gTraceRingsMutex;
+static vector<std::shared_ptr<TraceRing>> gTraceRings;   // guarded by gTraceRingsMutex
+static thread_local const char *tTraceThreadName = nullptr;
+
+static inline uint64_t traceNs(std::chrono::steady_clock::time_point t) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(t - gTraceStart).count();
+}
+
+// This thread's ring, registered on first use (the only locked step)
+static TraceRing &traceRing() {
+    static thread_local std::shared_ptr<TraceRing> ring;
+    if (!ring) {
+        auto r = std::make_shared<TraceRing>();
+        std::lock_guard<std::mutex> g(gTraceRingsMutex);
+        r->tid = (uint32_t)gTraceRings.size() + 1;
+        r->threadName = tTraceThreadName ? tTraceThreadName : "thread " + to_string(r->tid);
+        gTraceRings.push_back(r);
+        ring = std::move(r);
+    }
+    return *ring;
+}
+
+static void traceRecord(const char *name, uint64_t startNs, uint64_t endNs, std::string_view detail = {}) {
+    TraceRing &r = traceRing();
+    const uint64_t h = r.head.load(std::memory_order_relaxed);
+    TraceEvent &e = r.events[h & (kTraceRingSize - 1)];
+    e.name = name;
+    e.startNs = startNs;
+    e.durNs = endNs - startNs;
+    const size_t n = min(detail.size(), sizeof e.detail - 1);
+    memcpy(e.detail, detail.data(), n);
+    e.detail[n] = '\0';
+    r.head.store(h + 1, std::memory_order_release);
+}
+
+class TraceScope {
+public:
+    explicit TraceScope(const char *name) : allocPhase(name), name(gTraceEnabled.load(std::memory_order_relaxed) ? name : nullptr) {
+        if (this->name) start = traceNs(std::chrono::steady_clock::now());
+    }
+    ~TraceScope() { if (name) traceRecord(name, start, traceNs(std::chrono::steady_clock::now()), detail); }
+    bool active() const { return name != nullptr; }
+    void setDetail(std::string_view d) { detail.assign(d.substr(0, sizeof(TraceEvent::detail) - 1)); }
+    void next(const char *nextName) {
+        allocPhase.next(nextName);
+        if (!name) return;
+        const uint64_t now = traceNs(std::chrono::steady_clock::now());
+        traceRecord(name, start, now, detail);
+        name = nextName;
+        start = now;
+        detail.clear();
+    }
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+private:
+    AllocPhase allocPhase;
+    const char *name;
+    uint64_t start = 0;
+    string detail;
+};
+#define FIN_TRACE_SCOPE(name) TraceScope finTraceScope(name)
+#define FIN_TRACE_SCOPE_DETAIL(name, detail) \
+    TraceScope finTraceScope(name); \
+    if (finTraceScope.active()) finTraceScope.setDetail(detail)
+#define FIN_TRACE_NEXT(name) finTraceScope.next(name)
+#define FIN_TRACE_THREAD(name) (tTraceThreadName = (name))
+
+struct PerfCounter {
+    std::atomic<uint64_t> calls{0}, timed{0}, totalNs{0}, maxNs{0}, rows{0};   // totalNs and maxNs cover the timed calls
+};
+static PerfCounter gPerf[(size_t)PerfOp::Count];
+static constexpr uint32_t kPerfSampleEvery = 64;   // power of two
+
+class PerfScope {
+public:
+    explicit PerfScope(PerfOp op, const vector<Transaction> *txs = nullptr, uint32_t weight = 1)
+        : counter(gPerf[(size_t)op]), name(kPerfOpNames[(size_t)op]), txs(txs), rowsAtStart(txs ? txs->size() : 0), weight(weight),
+          start(std::chrono::steady_clock::now()) {}
+    ~PerfScope() {
+        const auto end = std::chrono::steady_clock::now();
+        const uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        // Sampled scopes stand for many calls, so they are left out of the trace
+        if (weight == 1 && gTraceEnabled.load(std::memory_order_relaxed)) traceRecord(name, traceNs(start), traceNs(end));
+        counter.calls.fetch_add(weight, std::memory_order_relaxed);
+        counter.timed.fetch_add(1, std::memory_order_relaxed);
+        counter.totalNs.fetch_add(ns, std::memory_order_relaxed);
+        uint64_t prev = counter.maxNs.load(std::memory_order_relaxed);
+        while (ns > prev && !counter.maxNs.compare_exchange_weak(prev, ns, std::memory_order_relaxed)) {}
+        if (txs && txs->size() > rowsAtStart) addRows(txs->size() - rowsAtStart);
+    }
+    void addRows(uint64_t n) { counter.rows.fetch_add(n, std::memory_order_relaxed); }
+    PerfScope(const PerfScope &) = delete;
+    PerfScope &operator=(const PerfScope &) = delete;
+private:
+    PerfCounter &counter;
+    const char *name;
+    AllocPhase allocPhase{name};
+    const vector<Transaction> *txs;
+    size_t rowsAtStart;
+    uint32_t weight;
+    std::chrono::steady_clock::time_point start;
+};
+#define FIN_PERF_SCOPE(op) PerfScope finPerfScope(PerfOp::op)
+#define FIN_PERF_SCOPE_TXS(op, txs) PerfScope finPerfScope(PerfOp::op, &(txs))
+#define FIN_PERF_SAMPLED_SCOPE(op) \
+    AllocPhase finAllocPhase(kPerfOpNames[(size_t)PerfOp::op]); \
+    static thread_local uint32_t finPerfTick = 0; \
+    std::optional<PerfScope> finPerfScope; \
+    if ((finPerfTick++ & (kPerfSampleEvery - 1)) == 0) finPerfScope.emplace(PerfOp::op, nullptr, kPerfSampleEvery)
+#define FIN_PERF_ROWS(n) finPerfScope.addRows((uint64_t)(n))
+#else
+#define FIN_TRACE_SCOPE(name) ((void)0)
+#define FIN_TRACE_SCOPE_DETAIL(name, detail) ((void)0)
+#define FIN_TRACE_NEXT(name) ((void)0)
+#define FIN_TRACE_THREAD(name) ((void)0)
+#define FIN_PERF_SCOPE(op) ((void)0)
+#define FIN_PERF_SCOPE_TXS(op, txs) ((void)0)
+#define FIN_PERF_SAMPLED_SCOPE(op) ((void)0)
+#define FIN_PERF_ROWS(n) ((void)0)
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // SECTION 2: FILESYSTEM & PATH HELPERS
@@ -91,7 +337,7 @@ static inline std::string getExecutableDir() {
 }
 
 // Resolve save file path at runtime so the executable can be moved without breaking persistence
-static inline std::string defaultSavePath() {
+static inline std::string resolveSavePath() {
     std::error_code ec;
     auto cwd = std::filesystem::current_path(ec);
     if (!ec) {
@@ -105,6 +351,13 @@ static inline std::string defaultSavePath() {
     return (std::filesystem::path("data") / "save" / "finance_save.txt").string();
 }
 
+// Save file path, resolved once per run. main() switches to the project root
+// before anything asks for it, so the first call sees the final directory.
+static inline const std::string &defaultSavePath() {
+    static const std::string path = resolveSavePath();
+    return path;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // SECTION 3: TIME & DATE HELPERS
 // Provides date parsing, formatting, and arithmetic operations
@@ -445,6 +698,596 @@ static inline bool tryParseRate(const string &sraw, double &outPct) {
 // - Scheduled transaction processing and interest application
 // - File persistence (loading/saving)
 
+// ---- Quick entry ----
+// QuickEntry: one parsed "DATE AMOUNT CATEGORY [NOTE...]" line (menu 11, batch 'add').
+// Category "auto" means: auto-allocate the (positive) amount by percentages.
+struct QuickEntry {
+    chrono_tp date;
+    double amount = 0.0;
+    string category;
+    string note;
+};
+
+// ---- Category index ----
+// CategoryIndex: persistent search structure over the category names used by
+// the interactive pickers. Keys (normalized names) and every word start inside
+// them are stored in a prefix trie, so completions come straight from the trie;
+// ranked fuzzy matching (substring, subsequence, small typos) scans the keys.
+// The numbered list shown to the user is kept sorted and only re-sorted when
+// categories were added. Categories are never removed one by one, so a smaller
+// source map means "rebuild" (see sync()).
+class CategoryIndex {
+public:
+    struct Match {
+        string display;
+        string key;
+        size_t number = 0;   // 1-based position in sorted()
+        int score = 0;
+    };
+
+    void clear() {
+        entries_.clear(); byKey_.clear(); sorted_.clear(); order_.clear(); number_.clear();
+        nodes_.assign(1, Node{});
+    }
+
+    // Bring the index up to date with Account::displayNames (normalized -> display).
+    // O(1) when nothing changed; new keys are inserted, a shrunk map is rebuilt.
+    void sync(const map<string, string> &displayNames) {
+        if (nodes_.empty()) nodes_.assign(1, Node{});
+        if (displayNames.size() == entries_.size()) return;
+        if (displayNames.size() < entries_.size()) clear();
+        size_t before = entries_.size();
+        for (auto &p : displayNames) {
+            if (byKey_.count(p.first)) continue;
+            insert(p.first, p.second.empty() ? p.first : p.second);
+        }
+        // a few new names are placed with a binary search; a fresh index is sorted once
+        if (entries_.size() - before <= 16) {
+            for (size_t id = before; id < entries_.size(); ++id) insertSorted((int)id);
+            renumber();
+        } else {
+            rebuildSorted();
+        }
+    }
+
+    size_t size() const { return entries_.size(); }
+
+    // (display, normalized) pairs sorted by display name; list numbers index into this
+    const vector<pair<string,string>> &sorted() const { return sorted_; }
+
+    // Ranked matches for a partial or misspelled name (best first, at most limit)
+    vector<Match> search(const string &query, size_t limit) const {
+        string q;
+        for (char c : query) q.push_back((char)tolower((unsigned char)c));
+        size_t a = q.find_first_not_of(" \t"), b = q.find_last_not_of(" \t");
+        vector<Match> out;
+        if (a == string::npos) {
+            // empty query: just the head of the sorted list
+            for (size_t i = 0; i < sorted_.size() && i < limit; ++i)
+                out.push_back({sorted_[i].first, sorted_[i].second, i + 1, 0});
+            return out;
+        }
+        q = q.substr(a, b - a + 1);
+
+        vector<int> score(entries_.size(), -1);
+        // 1) trie: whole-key and word prefixes
+        int node = 0;
+        for (char c : q) { node = child(node, c); if (node < 0) break; }
+        if (node >= 0) {
+            vector<int> stack{node};
+            while (!stack.empty()) {
+                int n = stack.back(); stack.pop_back();
+                for (auto &h : nodes_[n].hits) {
+                    const string &key = entries_[h.first].key;
+                    int sc = h.second == 0 ? (key.size() == q.size() ? 1000 : 800) : 600;
+                    sc -= (int)min<size_t>(key.size() - q.size(), 100);
+                    score[h.first] = max(score[h.first], sc);
+                }
+                for (auto &c : nodes_[n].next) stack.push_back(c.second);
+            }
+        }
+        size_t found = 0;
+        for (int sc : score) if (sc >= 0) ++found;
+        const uint32_t qMask = letterMask(q);
+        // 2) fuzzy scan for everything the trie did not catch; every tier scores
+        // below the previous one, so a tier only runs while results are missing
+        if (found < limit) {
+            for (size_t id = 0; id < entries_.size(); ++id) {
+                if (score[id] >= 0 || (qMask & ~entries_[id].mask)) continue; // needs every letter of q
+                const string &key = entries_[id].key;
+                size_t pos = key.find(q);
+                if (pos != string::npos) { score[id] = 400 - (int)min<size_t>(pos, 100); ++found; continue; }
+                int gaps = subsequenceGaps(q, key);
+                if (gaps >= 0) { score[id] = 200 - min(gaps, 100); ++found; }
+            }
+        }
+        const int maxEdits = q.size() >= 6 ? 2 : (q.size() >= 3 ? 1 : 0);
+        if (found < limit && maxEdits > 0) {
+            for (size_t id = 0; id < entries_.size(); ++id) {
+                // each letter of q missing from the key costs at least one edit
+                if (score[id] >= 0 || (int)std::bitset<32>(qMask & ~entries_[id].mask).count() > maxEdits) continue;
+                const string &key = entries_[id].key;
+                int d = min(boundedEditDistance(q, key.data(), key.size(), maxEdits),
+                            boundedEditDistance(q, key.data(), min(key.size(), q.size()), maxEdits));
+                if (d <= maxEdits) score[id] = 100 - 30 * d;
+            }
+        }
+
+        vector<int> ids;
+        for (size_t id = 0; id < score.size(); ++id) if (score[id] >= 0) ids.push_back((int)id);
+        auto better = [&](int x, int y) {
+            if (score[x] != score[y]) return score[x] > score[y];
+            return number_[x] < number_[y];
+        };
+        if (ids.size() > limit) {
+            partial_sort(ids.begin(), ids.begin() + limit, ids.end(), better);
+            ids.resize(limit);
+        } else {
+            sort(ids.begin(), ids.end(), better);
+        }
+        for (int id : ids) out.push_back({entries_[id].display, entries_[id].key, number_[id], score[id]});
+        return out;
+    }
+
+private:
+    struct Entry { string key; string display; uint32_t mask; };
+    struct Node {
+        vector<pair<char,int>> next;      // sorted by char
+        vector<pair<int,int>> hits;       // (entry id, word index) ending here
+    };
+    vector<Entry> entries_;
+    unordered_map<string, int> byKey_;
+    vector<Node> nodes_ = vector<Node>(1);
+    vector<pair<string,string>> sorted_;
+    vector<int> order_;                   // entry ids in sorted_ order
+    vector<size_t> number_;               // entry id -> 1-based list number
+
+    int child(int n, char c) const {
+        auto &nx = nodes_[n].next;
+        auto it = lower_bound(nx.begin(), nx.end(), make_pair(c, INT_MIN));
+        return (it != nx.end() && it->first == c) ? it->second : -1;
+    }
+
+    void insertPath(const string &key, size_t from, int id, int word) {
+        int n = 0;
+        for (size_t i = from; i < key.size(); ++i) {
+            char c = key[i];
+            auto &nx = nodes_[n].next;
+            auto it = lower_bound(nx.begin(), nx.end(), make_pair(c, INT_MIN));
+            if (it != nx.end() && it->first == c) { n = it->second; continue; }
+            int fresh = (int)nodes_.size();
+            nx.insert(it, {c, fresh});   // before push_back: nx refers into nodes_
+            nodes_.push_back(Node{});
+            n = fresh;
+        }
+        nodes_[n].hits.push_back({id, word});
+    }
+
+    void insert(const string &key, const string &display) {
+        int id = (int)entries_.size();
+        entries_.push_back({key, display, letterMask(key)});
+        byKey_[key] = id;
+        int word = 0;
+        for (size_t i = 0; i < key.size(); ++i) {
+            bool start = i == 0 || (key[i-1] == ' ' && key[i] != ' ');
+            if (start) insertPath(key, i, id, word++);
+        }
+        if (key.empty()) insertPath(key, 0, id, 0);
+    }
+
+    bool sortsBefore(int x, int y) const {
+        if (entries_[x].display != entries_[y].display) return entries_[x].display < entries_[y].display;
+        return entries_[x].key < entries_[y].key;
+    }
+
+    void insertSorted(int id) {
+        auto it = upper_bound(order_.begin(), order_.end(), id, [&](int x, int y) { return sortsBefore(x, y); });
+        size_t at = (size_t)(it - order_.begin());
+        order_.insert(it, id);
+        sorted_.insert(sorted_.begin() + at, {entries_[id].display, entries_[id].key});
+    }
+
+    void renumber() {
+        number_.assign(entries_.size(), 0);
+        for (size_t i = 0; i < order_.size(); ++i) number_[order_[i]] = i + 1;
+    }
+
+    void rebuildSorted() {
+        order_.resize(entries_.size());
+        for (size_t i = 0; i < order_.size(); ++i) order_[i] = (int)i;
+        sort(order_.begin(), order_.end(), [&](int x, int y) { return sortsBefore(x, y); });
+        sorted_.clear();
+        sorted_.reserve(order_.size());
+        for (int id : order_) sorted_.emplace_back(entries_[id].display, entries_[id].key);
+        renumber();
+    }
+
+    // Bit i set when letter 'a'+i occurs (digits share bit 26, anything else bit 27)
+    static uint32_t letterMask(const string &s) {
+        uint32_t m = 0;
+        for (unsigned char c : s) {
+            if (c >= 'a' && c <= 'z') m |= 1u << (c - 'a');
+            else if (c >= '0' && c <= '9') m |= 1u << 26;
+            else if (c != ' ') m |= 1u << 27;
+        }
+        return m;
+    }
+
+    // Number of skipped characters if q is a subsequence of key, else -1
+    static int subsequenceGaps(const string &q, const string &key) {
+        size_t j = 0;
+        int gaps = 0;
+        for (size_t i = 0; i < key.size() && j < q.size(); ++i) {
+            if (key[i] == q[j]) ++j;
+            else if (j > 0) ++gaps;
+        }
+        return j == q.size() ? gaps : -1;
+    }
+
+    // Levenshtein distance (with adjacent transpositions) between a and b[0, bn);
+    // returns limit + 1 as soon as it exceeds limit. Names longer than 63 are skipped.
+    static int boundedEditDistance(const string &a, const char *b, size_t bn, int limit) {
+        if ((int)a.size() - (int)bn > limit || (int)bn - (int)a.size() > limit) return limit + 1;
+        if (a.size() > 63 || bn > 63) return limit + 1;
+        int rows[3][64];
+        int *prev2 = rows[0], *prev = rows[1], *cur = rows[2];
+        for (size_t j = 0; j <= bn; ++j) prev[j] = (int)j;
+        for (size_t i = 1; i <= a.size(); ++i) {
+            cur[0] = (int)i;
+            int rowMin = cur[0];
+            for (size_t j = 1; j <= bn; ++j) {
+                int cost = a[i-1] == b[j-1] ? 0 : 1;
+                cur[j] = min({prev[j] + 1, cur[j-1] + 1, prev[j-1] + cost});
+                if (i > 1 && j > 1 && a[i-1] == b[j-2] && a[i-2] == b[j-1]) cur[j] = min(cur[j], prev2[j-2] + 1);
+                rowMin = min(rowMin, cur[j]);
+            }
+            if (rowMin > limit) return limit + 1;
+            int *t = prev2; prev2 = prev; prev = cur; cur = t;
+        }
+        return min(prev[bn], limit + 1);
+    }
+};
+
+// ---- Save snapshots ----
+// AccountSnapshot: immutable copy of everything saveToFile writes.
+// Transactions are shared as append-only chunks, so taking a snapshot only
+// copies the small maps plus the rows added since the previous snapshot.
+// The writer can then serialize it on another thread while the UI keeps mutating.
+using TxChunk = std::shared_ptr<const vector<Transaction>>;
+
+struct AccountSnapshot {
+    double balance = 0.0;
+    Settings settings;
+    map<string, InterestEntry> interestMap;
+    map<string, double> allocationPct;
+    map<string, double> categoryBalances;
+    map<string, string> displayNames;
+    vector<Schedule> schedules;
+    vector<TxChunk> txChunks;
+    size_t rows = 0;                 // total rows in txChunks
+    unsigned syncGeneration = 0;     // Account::fileSync.generation when taken
+
+    // Display name for a normalized key (falls back to the key itself)
+    const string &displayFor(const string &nk) const {
+        auto it = displayNames.find(nk);
+        return (it == displayNames.end() || it->second.empty()) ? nk : it->second;
+    }
+};
+
+// Serializes writes to the same save file from different threads of this process
+static std::mutex gSaveFileMutex;
+
+// writeSaveHeader: everything before the transaction rows, ending with the "TXS" line
+static void writeSaveHeader(std::ostream &os, const AccountSnapshot &snap) {
+    os << fixed << setprecision(10);
+    os << "BALANCE " << snap.balance << "\n";
+    // SETTINGS
+    os << "SETTINGS\n";
+    os << "AUTO_SAVE|" << (snap.settings.autoSave ? "1" : "0") << "\n";
+    os << "AUTO_PROCESS_STARTUP|" << (snap.settings.autoProcessOnStartup ? "1" : "0") << "\n";
+    os << "LANGUAGE|" << snap.settings.language << "\n";
+
+    os << "INTERESTS\n";
+    // Save: category|rate|monthly|start|lastApplied
+    for (auto &kv : snap.interestMap) {
+        auto &ie = kv.second;
+        os << escapeForSave(snap.displayFor(ie.categoryNormalized)) << "|" << ie.ratePct << "|" << (ie.monthly ? "1" : "0")
+           << "|" << escapeForSave(toDateString(ie.startDate)) << "|" << escapeForSave(toDateString(ie.lastAppliedDate)) << "\n";
+    }
+    os << "ALLOCATIONS\n";
+    for (auto &p : snap.allocationPct) {
+        os << escapeForSave(snap.displayFor(p.first)) << "|" << p.second << "\n";
+    }
+    os << "CATEGORIES\n";
+    for (auto &p : snap.categoryBalances) {
+        os << escapeForSave(snap.displayFor(p.first)) << "|" << p.second << "\n";
+    }
+    os << "SCHEDULES\n";
+    // Save: type|param|amount|auto|date|category|note
+    for (auto &s : snap.schedules) {
+        os << (s.type==ScheduleType::EveryXDays? "E":"M") << "|"
+           << s.param << "|" << s.amount << "|"
+           << (s.autoAllocate ? "1" : "0") << "|" << escapeForSave(toDateString(s.nextDate)) << "|"
+           << escapeForSave(s.category) << "|" << escapeForSave(s.note) << "\n";
+    }
+    os << "TXS\n";
+}
+
+// writeAccountSnapshot: write a snapshot in the pipe-delimited save format.
+// Writes to "<filename>.tmp" first and renames it over the target, so readers
+// (and crashes mid-save) never observe a half-written file.
+static bool writeAccountSnapshot(const AccountSnapshot &snap, const string &filename) {
+    std::lock_guard<std::mutex> g(gSaveFileMutex);
+    try {
+        std::filesystem::path ppath(filename);
+        if (!ppath.parent_path().empty()) std::filesystem::create_directories(ppath.parent_path());
+    } catch (...) { /* ignore directory creation errors */ }
+    const string tmpName = filename + ".tmp";
+    // Binary mode: byte offsets recorded in SaveFileSync must match on every platform
+    ofstream ofs(tmpName, ios::out | ios::trunc | ios::binary);
+    if (!ofs) { cerr << "Cannot open file to save: " << tmpName << "\n"; return false; }
+    FIN_TRACE_SCOPE("write header");
+    writeSaveHeader(ofs, snap);
+    FIN_TRACE_NEXT("write rows");
+    for (auto &chunk : snap.txChunks) {
+        for (auto &t : *chunk) {
+            ofs << escapeForSave(toDateString(t.date)) << "|" << t.amount << "|" << escapeForSave(t.category) << "|" << escapeForSave(t.note) << "\n";
+        }
+    }
+    ofs.close();
+    if (!ofs) { cerr << "Failed writing save file: " << tmpName << "\n"; return false; }
+#ifndef _WIN32
+    // Make the new contents durable before they replace the old file
+    FIN_TRACE_NEXT("fsync");
+    int fd = ::open(tmpName.c_str(), O_RDONLY);
+    if (fd >= 0) { ::fsync(fd); ::close(fd); }
+#endif
+    FIN_TRACE_NEXT("rename");
+    std::error_code ec;
+    std::filesystem::rename(tmpName, filename, ec);
+    if (ec) {
+        cerr << "Cannot replace save file " << filename << ": " << ec.message() << "\n";
+        std::filesystem::remove(tmpName, ec);
+        return false;
+    }
+    return true;
+}
+
+// ---- Multi-instance coordination ----
+// Several instances (interactive, --tui, --batch, --daemon) may share one save
+// file. Every check-and-write cycle on it runs under SaveFileLock, and each
+// Account remembers in SaveFileSync what the file looked like when it last
+// loaded or saved it. Saves rewrite the whole file, but the rows already in it
+// are written back unchanged, so "another instance added transactions" shows
+// up as a TXS section that still starts with the bytes we know; only the rows
+// after them are parsed and merged (see Account::mergeExternalChangesLocked).
+
+static std::mutex gSaveLockMutex;
+
+// SaveFileLock: exclusive lock on a save file for the threads of this process
+// and, through an advisory flock on "<file>.lock" (the save file itself is
+// replaced by rename, so it cannot carry the lock), for other processes.
+// Lock order: account mutex -> SaveFileLock -> gSaveFileMutex.
+class SaveFileLock {
+public:
+    explicit SaveFileLock(const string &filename) : lockPath(filename + ".lock") { lock(); }
+    ~SaveFileLock() { unlock(); }
+
+    SaveFileLock(const SaveFileLock &) = delete;
+    SaveFileLock &operator=(const SaveFileLock &) = delete;
+
+    void lock() {
+        if (held) return;
+        gSaveLockMutex.lock();
+        held = true;
+#ifndef _WIN32
+        std::error_code ec;
+        std::filesystem::path p(lockPath);
+        if (!p.parent_path().empty()) std::filesystem::create_directories(p.parent_path(), ec);
+        // Without a lock file (read-only directory) only this process is serialized
+        fd = ::open(lockPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        if (fd >= 0) {
+            while (::flock(fd, LOCK_EX) != 0 && errno == EINTR) {}
+        }
+#endif
+    }
+
+    void unlock() {
+        if (!held) return;
+#ifndef _WIN32
+        if (fd >= 0) { ::flock(fd, LOCK_UN); ::close(fd); fd = -1; }
+#endif
+        held = false;
+        gSaveLockMutex.unlock();
+    }
+
+private:
+    string lockPath;
+    int fd = -1;
+    bool held = false;
+};
+
+// SaveFileSync: what an Account last read from or wrote to its save file
+struct SaveFileSync {
+    string path;                                // empty until the first load/save
+    uintmax_t size = 0;
+    std::filesystem::file_time_type mtime{};
+    uintmax_t txsOffset = 0;                    // first byte after the "TXS" line
+    uint64_t headerHash = 0;                    // see hashSaveHeader
+    uint64_t rowsHash = 0;                      // the whole TXS section; FNV-1a extends over appended bytes
+    size_t rows = 0;                            // txs[0, rows) are the file's TXS rows
+    unsigned generation = 0;                    // bumped whenever txs changed underneath snapshots
+};
+
+static inline uint64_t fnv1a(const char *p, size_t n, uint64_t h = 1469598103934665603ull) {
+    for (size_t i = 0; i < n; ++i) { h ^= (unsigned char)p[i]; h *= 1099511628211ull; }
+    return h;
+}
+
+// hashSaveHeader: read the header up to and including the "TXS" line.
+// The hash covers the user-edited sections (SETTINGS, INTERESTS, ALLOCATIONS,
+// SCHEDULES); BALANCE and CATEGORIES are derived from the rows and skipped.
+// Returns false if there is no TXS line; *txsOffset is the bytes consumed.
+static bool hashSaveHeader(std::istream &in, uint64_t &hash, uintmax_t *txsOffset = nullptr, string *headerText = nullptr) {
+    hash = fnv1a(nullptr, 0);
+    uintmax_t consumed = 0;
+    bool derived = false;
+    string line;
+    while (getline(in, line)) {
+        consumed += line.size() + (in.eof() ? 0 : 1);
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (headerText) { *headerText += line; *headerText += '\n'; }
+        if (line == "TXS") { if (txsOffset) *txsOffset = consumed; return true; }
+        if (line == "CATEGORIES") { derived = true; continue; }
+        if (line == "SETTINGS" || line == "INTERESTS" || line == "ALLOCATIONS" || line == "SCHEDULES") derived = false;
+        if (derived || line.rfind("BALANCE ", 0) == 0) continue;
+        hash = fnv1a(line.data(), line.size(), hash);
+        hash = fnv1a("\n", 1, hash);
+    }
+    if (txsOffset) *txsOffset = consumed;
+    return false;
+}
+
+// Hash len bytes of a file starting at offset, continuing from seed (the hash
+// of the bytes before them); false if they cannot be read
+static bool hashFileRange(const string &filename, uintmax_t offset, uintmax_t len, uint64_t &hash,
+                          uint64_t seed = fnv1a(nullptr, 0)) {
+    ifstream ifs(filename, ios::in | ios::binary);
+    if (!ifs) return false;
+    ifs.seekg((std::streamoff)offset);
+    hash = seed;
+    char buf[1 << 16];
+    while (len > 0) {
+        const size_t n = (size_t)min<uintmax_t>(len, sizeof buf);
+        if (!ifs.read(buf, (std::streamsize)n)) return false;
+        hash = fnv1a(buf, n, hash);
+        len -= n;
+    }
+    return true;
+}
+
+// Inode of a file (0 where there is none); with size and mtime it tells
+// whether a file is still the one a checkpoint was written for
+static uint64_t fileInode(const string &filename) {
+#ifndef _WIN32
+    struct stat sb;
+    if (::stat(filename.c_str(), &sb) == 0) return (uint64_t)sb.st_ino;
+#else
+    (void)filename;
+#endif
+    return 0;
+}
+
+// readSaveFileState: stat and fingerprint a save file (rows/path/generation are left to the caller).
+// hashRows=false leaves rowsHash to callers that can extend a hash they already trust.
+static bool readSaveFileState(const string &filename, SaveFileSync &st, string *headerText = nullptr, bool hashRows = true) {
+    FIN_TRACE_SCOPE("fingerprint save file");
+    std::error_code ec;
+    st.size = std::filesystem::file_size(filename, ec);
+    if (ec) return false;
+    st.mtime = std::filesystem::last_write_time(filename, ec);
+    if (ec) return false;
+    ifstream ifs(filename, ios::in | ios::binary);
+    if (!ifs) return false;
+    if (!hashSaveHeader(ifs, st.headerHash, &st.txsOffset, headerText)) st.txsOffset = st.size;
+    ifs.close();
+    if (st.txsOffset > st.size) st.txsOffset = st.size;
+    return !hashRows || hashFileRange(filename, st.txsOffset, st.size - st.txsOffset, st.rowsHash);
+}
+
+// parseSavedTxLine: one "date|amount|category|note" row; warns and returns false if malformed
+static bool parseSavedTxLine(const string &line, Transaction &t) {
+    auto parts = splitEscaped(line);
+    if (parts.size() < 4) { cerr << "Warning: invalid tx line: " << line << "\n"; return false; }
+    chrono_tp dt;
+    if (!tryParseDate(parts[0], dt)) { cerr << "Warning: invalid tx date '" << parts[0] << "'. Skipping tx.\n"; return false; }
+    t.date = dt;
+    try { t.amount = stod(parts[1]); } catch (...) { cerr << "Warning: invalid tx amount\n"; return false; }
+    t.category = parts[2];
+    t.note = parts[3];
+    return true;
+}
+
+// ---- Save checkpoint ----
+// "<save>.ckpt" records what parsing every TXS row derives (the balance and
+// the per-category balances) for the rows a save file held when it was
+// written, identified by their byte length and a hash of all of them, along
+// with that file's size, mtime and inode. A start that finds the same file
+// trusts it as is; if the file changed, the TXS section must still begin
+// with the hashed rows (read, not parsed). Either way only the header and
+// the rows appended after them are parsed and the rest is left for later
+// (see Account::loadFromCheckpointLocked).
+struct SaveCheckpoint {
+    uintmax_t rowsBytes = 0;                    // length of the TXS section it describes
+    uint64_t rowsHash = 0;                      // hash of all of it
+    uintmax_t fileSize = 0;                     // the save file it was written for
+    int64_t fileMtime = 0;
+    uint64_t fileInode = 0;
+    double balance = 0.0;
+    vector<pair<string, double>> categories;    // display name -> balance
+};
+
+static string checkpointPath(const string &filename) { return filename + ".ckpt"; }
+
+// Write the checkpoint for save file state st. Like the save file it goes
+// through a temporary file and a rename; the last line hashes the others, so
+// a damaged checkpoint is ignored.
+static bool writeSaveCheckpoint(const string &filename, const SaveFileSync &st, const AccountSnapshot &snap) {
+    FIN_TRACE_SCOPE("write checkpoint");
+    std::ostringstream os;
+    os << setprecision(17);
+    os << "FINCKPT 2\n";
+    os << "ROWS|" << (st.size - st.txsOffset) << "|" << st.rowsHash << "\n";
+    os << "FILE|" << st.size << "|" << (int64_t)st.mtime.time_since_epoch().count() << "|" << fileInode(filename) << "\n";
+    os << "BALANCE|" << snap.balance << "\n";
+    for (auto &p : snap.categoryBalances) os << escapeForSave(snap.displayFor(p.first)) << "|" << p.second << "\n";
+    string body = os.str();
+    body += "END|" + to_string(fnv1a(body.data(), body.size())) + "\n";
+
+    const string path = checkpointPath(filename), tmp = path + ".tmp";
+    {
+        ofstream ofs(tmp, ios::out | ios::trunc | ios::binary);
+        if (!ofs || !ofs.write(body.data(), (std::streamsize)body.size())) return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) { std::filesystem::remove(tmp, ec); return false; }
+    return true;
+}
+
+static bool readSaveCheckpoint(const string &filename, SaveCheckpoint &ck) {
+    ifstream ifs(checkpointPath(filename), ios::in | ios::binary);
+    if (!ifs) return false;
+    const string body((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    const size_t end = body.rfind("END|");
+    if (end == string::npos || end == 0 || body[end - 1] != '\n') return false;
+    try {
+        if (stoull(body.substr(end + 4)) != fnv1a(body.data(), end)) return false;
+        std::istringstream is(body.substr(0, end));
+        string line;
+        if (!getline(is, line) || line != "FINCKPT 2") return false;
+        if (!getline(is, line)) return false;
+        auto rows = splitEscaped(line);
+        if (rows.size() != 3 || rows[0] != "ROWS") return false;
+        ck.rowsBytes = (uintmax_t)stoull(rows[1]);
+        ck.rowsHash = (uint64_t)stoull(rows[2]);
+        if (!getline(is, line)) return false;
+        auto file = splitEscaped(line);
+        if (file.size() != 4 || file[0] != "FILE") return false;
+        ck.fileSize = (uintmax_t)stoull(file[1]);
+        ck.fileMtime = (int64_t)stoll(file[2]);
+        ck.fileInode = (uint64_t)stoull(file[3]);
+        if (!getline(is, line) || line.rfind("BALANCE|", 0) != 0) return false;
+        ck.balance = stod(line.substr(8));
+        while (getline(is, line)) {
+            auto parts = splitEscaped(line);
+            if (parts.size() != 2) return false;
+            ck.categories.emplace_back(parts[0], stod(parts[1]));
+        }
+    } catch (...) { return false; }
+    return true;
+}
+
 struct Account {
     // Core financial data
     double balance = 0.0;                    // Total account balance
@@ -462,6 +1305,25 @@ struct Account {
     // User settings
     Settings settings;
 
+    // Immutable copies of txs[0, snapshotRows) shared with in-flight saves (see snapshot())
+    vector<TxChunk> snapshotChunks;
+    size_t snapshotRows = 0;
+
+    // Search index over displayNames for the category pickers (see categories())
+    CategoryIndex categoryIndex;
+
+    // State of the save file as of our last load/save; guarded by SaveFileLock
+    SaveFileSync fileSync;
+
+    // TXS rows left in the file by a checkpoint load; they are the first
+    // `bytes` of the file's TXS section (see ensureHistory)
+    struct DeferredHistory {
+        string file;
+        uintmax_t bytes = 0;
+        uint64_t rowsHash = 0;      // all of those rows, as in SaveFileSync
+    };
+    std::optional<DeferredHistory> deferredHistory;
+
     // Constructor: Initialize with default categories and settings
     Account() {
         // Create default category allocations
@@ -478,6 +1340,12 @@ struct Account {
     }
 
     // ---- Category management helpers ----
+    // Category index synced with displayNames; cheap when no category was added
+    const CategoryIndex &categories() {
+        categoryIndex.sync(displayNames);
+        return categoryIndex;
+    }
+
     // Ensure a category exists in the internal maps with zero balance
     // Does nothing if category already exists
     void ensureCategoryExists(const string &displayRaw) {
@@ -503,6 +1371,34 @@ struct Account {
         categoryBalances[nk] += amount;
     }
 
+    // Add a block of quick-entry transactions in one pass
+    // Each distinct category is resolved once, rows are appended after a single
+    // reserve and the balance is updated once with the batch total.
+    void addTransactionsBatch(const vector<QuickEntry> &entries) {
+        txs.reserve(txs.size() + entries.size());
+        map<string, string> keyFor;         // raw category -> normalized key
+        map<string, double> deltas;         // normalized key -> sum of batch amounts
+        double total = 0.0;
+        for (const auto &e : entries) {
+            if (e.category == "auto") {
+                allocateAmount(e.date, e.amount, e.note + " (manual income)");
+                continue;
+            }
+            auto it = keyFor.find(e.category);
+            if (it == keyFor.end()) {
+                string catDisplay = e.category.empty() ? "Other" : sanitizeDisplayName(e.category);
+                string nk = normalizeKey(catDisplay);
+                if (displayNames.find(nk) == displayNames.end()) displayNames[nk] = catDisplay;
+                it = keyFor.emplace(e.category, nk).first;
+            }
+            txs.push_back({e.date, e.amount, displayNames[it->second], e.note});
+            deltas[it->second] += e.amount;
+            total += e.amount;
+        }
+        for (auto &d : deltas) categoryBalances[d.first] += d.second;
+        balance += total;
+    }
+
     // ---- Allocation management ----
     // Set category allocation percentages from user-provided map
     // Clears existing allocations and rebuilds from input
@@ -523,6 +1419,7 @@ struct Account {
     // Falls back to "Other" if no allocations are defined
     // Used for: scheduled income allocation, manual allocation operations
     void allocateAmount(const chrono_tp &date, double amount, const string &note) {
+        FIN_PERF_SCOPE_TXS(AllocateAmount, txs);
         double totalPct = 0;
         for (auto &p : allocationPct) totalPct += p.second;
         if (totalPct <= 0.000001) {
@@ -557,7 +1454,9 @@ struct Account {
     //   - Otherwise: Add as manual transaction to specified category
     // Guard limit based on expected occurrences + no-progress detection prevents infinite loops
     void processSchedulesUpTo(const chrono_tp &upTo) {
+        FIN_PERF_SCOPE_TXS(ProcessSchedules, txs);
         for (auto &s : schedules) {
+            FIN_TRACE_SCOPE_DETAIL("schedule", s.note.empty() ? s.category : s.note);
             if (s.type == ScheduleType::EveryXDays && s.param <= 0) {
                 cerr << "Skipping schedule with non-positive interval (EveryXDays param=" << s.param << ")\n";
                 continue;
@@ -620,6 +1519,7 @@ struct Account {
     //
     // Important: If balance <= 0 in a month, no interest is applied (but date still advances)
     void applyInterestUpTo(const chrono_tp &upTo) {
+        FIN_PERF_SCOPE_TXS(ApplyInterest, txs);
         if (interestMap.empty()) return;
 
         // We'll snapshot existing transactions and then for each interest entry, simulate month-by-month.
@@ -630,6 +1530,7 @@ struct Account {
             InterestEntry &ie = kv.second;
             // If startDate > upTo, skip
             if (ie.startDate > upTo) continue;
+            FIN_TRACE_SCOPE_DETAIL("interest", kv.first);
 
             // Determine months to apply from ie.lastAppliedDate (exclusive) up to upTo
             chrono_tp baseDate = ie.lastAppliedDate;
@@ -646,6 +1547,7 @@ struct Account {
             for (int m = 0; m < months; ++m) {
                 // compute applyDate as addMonths(firstApplyDate, m)
                 chrono_tp applyDate = addMonths(firstApplyDate, m);
+                FIN_TRACE_SCOPE_DETAIL("interest month", kv.first + " " + toDateString(applyDate));
 
                 // compute balance for this category in workingTxs up to applyDate (inclusive)
                 double bal = 0.0;
@@ -711,10 +1613,13 @@ struct Account {
                  << " note=" << s.note << "\n";
         }
         cout << "\n\nRecent transactions (last 10):\n";
-        int start = max(0, (int)txs.size()-10);
-        for (int i = (int)txs.size()-1; i >= start; --i)
-            cout << toDateString(txs[i].date) << " | " << setw(10) << txs[i].amount
-                 << " | " << txs[i].category << " | " << txs[i].note << "\n";
+        // With the history still deferred only the end of the file is read
+        vector<Transaction> recent = deferredTail(10);
+        recent.insert(recent.end(), txs.end() - (ptrdiff_t)min<size_t>(txs.size(), 10), txs.end());
+        int start = max(0, (int)recent.size()-10);
+        for (int i = (int)recent.size()-1; i >= start; --i)
+            cout << toDateString(recent[i].date) << " | " << setw(10) << recent[i].amount
+                 << " | " << recent[i].category << " | " << recent[i].note << "\n";
         cout << "=========================\n";
     }
 
@@ -723,54 +1628,194 @@ struct Account {
     // Format includes: balance, settings, interest rates, allocations, categories, schedules, transactions
     // All text fields are escaped to safely handle special characters
     // Creates parent directories if needed
-    void saveToFile(const string &filename = defaultSavePath()) {
-        try {
-            std::filesystem::path ppath(filename);
-            if (!ppath.parent_path().empty()) std::filesystem::create_directories(ppath.parent_path());
-        } catch (...) { /* ignore directory creation errors */ }
-        ofstream ofs(filename);
-        if (!ofs) { cerr << "Cannot open file to save: " << filename << "\n"; return; }
-        ofs << fixed << setprecision(10);
-        ofs << "BALANCE " << balance << "\n";
-        // SETTINGS
-        ofs << "SETTINGS\n";
-        ofs << "AUTO_SAVE|" << (settings.autoSave ? "1" : "0") << "\n";
-        ofs << "AUTO_PROCESS_STARTUP|" << (settings.autoProcessOnStartup ? "1" : "0") << "\n";
-        ofs << "LANGUAGE|" << settings.language << "\n";
-
-        ofs << "INTERESTS\n";
-        // Save: category|rate|monthly|start|lastApplied
-        for (auto &kv : interestMap) {
-            auto &ie = kv.second;
-            string display = displayNames.count(ie.categoryNormalized) ? displayNames[ie.categoryNormalized] : ie.categoryNormalized;
-            ofs << escapeForSave(display) << "|" << ie.ratePct << "|" << (ie.monthly ? "1" : "0")
-                << "|" << escapeForSave(toDateString(ie.startDate)) << "|" << escapeForSave(toDateString(ie.lastAppliedDate)) << "\n";
+    // announce=false skips the "saved to" UI message (background saves)
+    // Transactions another instance added to the file meanwhile are merged first.
+    void saveToFile(const string &filename = defaultSavePath(), bool announce = true) {
+        SaveFileLock fileLock(filename);
+        mergeExternalChangesLocked(filename, true);
+        if (!writeSnapshotLocked(snapshot(), filename)) return;
+        // UI message: show in user's language
+        if (announce) cout << tr(settings, Msg::saved_to) << filename << "\n";
+    }
+
+    // Write a snapshot while holding SaveFileLock and remember the file state.
+    // Apart from the disk it only touches fileSync, so the background writer
+    // may call it without the account mutex.
+    bool writeSnapshotLocked(const AccountSnapshot &snap, const string &filename) {
+        FIN_PERF_SCOPE(SaveToFile);   // every save (menu 7, auto-save, exit) ends here
+        if (!writeAccountSnapshot(snap, filename)) return false;
+        FIN_PERF_ROWS(snap.rows);
+        if (fileSync.path.empty() || fileSync.path == filename) {
+            SaveFileSync st;
+            if (readSaveFileState(filename, st)) {
+                st.path = filename;
+                st.rows = snap.rows;
+                st.generation = fileSync.generation;
+                fileSync = st;
+                writeSaveCheckpoint(filename, st, snap);
+            }
         }
-        ofs << "ALLOCATIONS\n";
-        for (auto &p : allocationPct) {
-            string display = displayNames[p.first].empty() ? p.first : displayNames[p.first];
-            ofs << escapeForSave(display) << "|" << p.second << "\n";
+        return true;
+    }
+
+    // Outcome of comparing the save file with what this instance last saw
+    struct ExternalChange {
+        size_t rowsAdded = 0;        // transactions another instance appended, now merged in
+        bool headerAdopted = false;  // their settings/allocations/schedules/interest replaced ours
+        bool reloaded = false;       // file was rewritten, nothing unsaved here: reloaded it
+        bool conflict = false;       // file was rewritten while we have unsaved changes
+    };
+
+    // Cheap check (two stat calls): has the file changed since our last load/save?
+    bool saveFileChangedLocked(const string &filename) const {
+        if (fileSync.path != filename) return false;
+        std::error_code ec;
+        uintmax_t size = std::filesystem::file_size(filename, ec);
+        if (ec) return false;   // missing file: the next save recreates it
+        auto mtime = std::filesystem::last_write_time(filename, ec);
+        return ec || size != fileSync.size || mtime != fileSync.mtime;
+    }
+
+    // Fingerprint of our own user-edited header sections, comparable with SaveFileSync::headerHash
+    uint64_t headerHash() const {
+        std::ostringstream os;
+        writeSaveHeader(os, headerSnapshot());
+        std::istringstream is(os.str());
+        uint64_t h = 0;
+        hashSaveHeader(is, h);
+        return h;
+    }
+
+    // Anything not yet in the save file? Requires SaveFileLock (reads fileSync).
+    bool hasUnsavedChangesLocked() const {
+        return fileSync.path.empty() || txs.size() != fileSync.rows || headerHash() != fileSync.headerHash;
+    }
+
+    // Bring in what other instances wrote to the save file since our last load/save.
+    // Appended rows are inserted after the rows we share with the file (our own
+    // unsaved rows stay last) and the balances are updated by their sums. Their
+    // header sections are adopted only if we did not change ours. A file that
+    // was rewritten otherwise is reloaded when we have nothing unsaved; if we
+    // do, ours wins and, when saving, their file is kept as "<file>.conflict".
+    // Requires SaveFileLock and the account mutex.
+    ExternalChange mergeExternalChangesLocked(const string &filename, bool saving) {
+        ExternalChange res;
+        if (!saveFileChangedLocked(filename)) return res;
+        FIN_TRACE_SCOPE("merge external changes");
+        SaveFileSync cur;
+        string headerText;
+        if (!readSaveFileState(filename, cur, &headerText, false)) return res;
+        const bool localHeader = headerHash() != fileSync.headerHash;
+        const bool localRows = txs.size() != fileSync.rows;
+
+        // Appended iff the TXS section still holds our known bytes at its start;
+        // the hash of the whole section then extends over the appended bytes
+        const uintmax_t known = fileSync.size - fileSync.txsOffset;
+        uint64_t prefix = 0;
+        bool appended = fileSync.rows <= txs.size() && cur.size - cur.txsOffset >= known
+            && hashFileRange(filename, cur.txsOffset, known, prefix) && prefix == fileSync.rowsHash
+            && hashFileRange(filename, cur.txsOffset + known, cur.size - cur.txsOffset - known, cur.rowsHash, prefix);
+
+        if (!appended) {
+            if (!localRows && !localHeader) {
+                res.reloaded = loadFromFileLocked(filename, false);
+                return res;
+            }
+            res.conflict = true;
+            if (saving) {
+                std::error_code ec;
+                std::filesystem::copy_file(filename, filename + ".conflict", std::filesystem::copy_options::overwrite_existing, ec);
+                cerr << "Warning: " << filename << " was rewritten by another instance; keeping this instance's data"
+                     << (ec ? string() : ", their version is in " + filename + ".conflict") << "\n";
+            }
+            return res;
         }
-        ofs << "CATEGORIES\n";
-        for (auto &p : categoryBalances) {
-            string display = displayNames[p.first].empty() ? p.first : displayNames[p.first];
-            ofs << escapeForSave(display) << "|" << p.second << "\n";
+
+        vector<Transaction> fresh;
+        {
+            ifstream ifs(filename, ios::in | ios::binary);
+            ifs.seekg((std::streamoff)(cur.txsOffset + known));
+            string line;
+            while (getline(ifs, line)) {
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                Transaction t;
+                if (parseSavedTxLine(line, t)) fresh.push_back(std::move(t));
+            }
         }
-        ofs << "SCHEDULES\n";
-        // Save: type|param|amount|auto|date|category|note
-        for (auto &s : schedules) {
-            ofs << (s.type==ScheduleType::EveryXDays? "E":"M") << "|"
-                << s.param << "|" << s.amount << "|"
-                << (s.autoAllocate ? "1" : "0") << "|" << escapeForSave(toDateString(s.nextDate)) << "|"
-                << escapeForSave(s.category) << "|" << escapeForSave(s.note) << "\n";
+        for (auto &t : fresh) {
+            string nk = normalizeKey(t.category);
+            balance += t.amount;
+            categoryBalances[nk] += t.amount;
+            if (displayNames.find(nk) == displayNames.end()) displayNames[nk] = t.category;
         }
-        ofs << "TXS\n";
-        for (auto &t : txs) {
-            ofs << escapeForSave(toDateString(t.date)) << "|" << t.amount << "|" << escapeForSave(t.category) << "|" << escapeForSave(t.note) << "\n";
+        // Rows captured by snapshots must stay a prefix of txs
+        if (fileSync.rows < snapshotRows) { snapshotChunks.clear(); snapshotRows = 0; }
+        txs.insert(txs.begin() + (ptrdiff_t)fileSync.rows, fresh.begin(), fresh.end());
+
+        if (cur.headerHash != fileSync.headerHash && !localHeader) {
+            Account theirs;
+            std::istringstream hs(headerText);
+            theirs.parseSaveStream(hs);
+            settings = theirs.settings;
+            interestMap = theirs.interestMap;
+            allocationPct = theirs.allocationPct;
+            schedules = theirs.schedules;
+            for (auto &p : theirs.displayNames) displayNames.insert(p);
+            for (auto &p : allocationPct) categoryBalances.insert({p.first, 0.0});
+            res.headerAdopted = true;
+        } else if (cur.headerHash != fileSync.headerHash) {
+            res.conflict = true;   // both sides edited settings: ours are written on the next save
         }
-        ofs.close();
-        // UI message: show in user's language
-        cout << tr(settings, "saved_to") << filename << "\n";
+
+        const size_t rows = fileSync.rows + fresh.size();
+        const unsigned generation = fileSync.generation + 1;
+        fileSync = cur;
+        fileSync.path = filename;
+        fileSync.rows = rows;
+        fileSync.generation = generation;
+        res.rowsAdded = fresh.size();
+        return res;
+    }
+
+    // Copy of everything saveToFile writes except the transaction rows
+    AccountSnapshot headerSnapshot() const {
+        AccountSnapshot snap;
+        snap.balance = balance;
+        snap.settings = settings;
+        snap.interestMap = interestMap;
+        snap.allocationPct = allocationPct;
+        snap.categoryBalances = categoryBalances;
+        snap.displayNames = displayNames;
+        snap.schedules = schedules;
+        return snap;
+    }
+
+    // Take an immutable snapshot for (background) saving.
+    // Relies on txs being append-only outside loadFromFile: rows already
+    // captured are reused, only new rows are copied into a fresh chunk.
+    // Chunks are merged binary-counter style so there are O(log n) of them.
+    // Requires SaveFileLock while rows are deferred (see ensureHistory).
+    AccountSnapshot snapshot() {
+        ensureHistoryLocked();
+        if (snapshotRows > txs.size()) { snapshotChunks.clear(); snapshotRows = 0; }
+        if (snapshotRows < txs.size()) {
+            auto fresh = std::make_shared<vector<Transaction>>(txs.begin() + (ptrdiff_t)snapshotRows, txs.end());
+            while (!snapshotChunks.empty() && snapshotChunks.back()->size() <= fresh->size()) {
+                auto merged = std::make_shared<vector<Transaction>>();
+                merged->reserve(snapshotChunks.back()->size() + fresh->size());
+                merged->insert(merged->end(), snapshotChunks.back()->begin(), snapshotChunks.back()->end());
+                merged->insert(merged->end(), fresh->begin(), fresh->end());
+                snapshotChunks.pop_back();
+                fresh = std::move(merged);
+            }
+            snapshotChunks.push_back(std::move(fresh));
+            snapshotRows = txs.size();
+        }
+        AccountSnapshot snap = headerSnapshot();
+        snap.txChunks = snapshotChunks;
+        snap.rows = snapshotRows;
+        snap.syncGeneration = fileSync.generation;
+        return snap;
     }
 
     // Load account state from file (inverse of saveToFile)
@@ -778,26 +1823,218 @@ struct Account {
     // Falls back to working directory if new location not found (legacy support)
     // Silently initializes defaults for missing settings
     // Returns false without raising exceptions - caller decides behavior
-    bool loadFromFile(const string &filename = defaultSavePath()) {
+    // Full parses every row. Checkpoint starts from the save file's checkpoint
+    // when it still describes the file (see loadFromCheckpointLocked) and
+    // otherwise parses everything and writes a fresh checkpoint for next time.
+    enum class LoadMode { Full, Checkpoint };
+
+    bool loadFromFile(const string &filename = defaultSavePath(), LoadMode mode = LoadMode::Full) {
+        SaveFileLock fileLock(filename);
+        return loadFromFileLocked(filename, true, mode);
+    }
+
+    // loadFromFile body; requires SaveFileLock. announce=false skips the "Loaded from" line.
+    bool loadFromFileLocked(const string &filename, bool announce = true, LoadMode mode = LoadMode::Full) {
+        FIN_PERF_SCOPE(LoadFromFile);
+        if (mode == LoadMode::Checkpoint && loadFromCheckpointLocked(filename)) {
+            if (announce) cout << "Loaded from " << filename << "\n";
+            return true;
+        }
+        bool legacy = false;
         ifstream ifs(filename);
         if (!ifs) {
             // Try legacy location (working directory) if the new location does not exist
             try {
                 std::filesystem::path p(filename);
                 auto base = p.filename().string();
-                if (base != filename) ifs.open(base);
+                if (base != filename) { ifs.open(base); legacy = true; }
             } catch (...) { /* ignore */ }
             if (!ifs) {
                 // do not treat as fatal here, caller will decide to set up or retry
                 return false;
             }
         }
+        parseSaveStream(ifs);
+        ifs.close();
+        FIN_PERF_ROWS(txs.size());
+
+        // Remember what we read; a legacy file is not tracked, the next save creates the real one
+        const unsigned generation = fileSync.generation + 1;
+        fileSync = SaveFileSync();
+        fileSync.generation = generation;
+        if (!legacy && readSaveFileState(filename, fileSync)) {
+            fileSync.path = filename;
+            fileSync.rows = txs.size();
+            if (mode == LoadMode::Checkpoint) writeSaveCheckpoint(filename, fileSync, headerSnapshot());
+        }
+
+        // UI message: show in user's language loaded message in English (save file not localized)
+        if (announce) cout << "Loaded from " << filename << "\n";
+        return true;
+    }
+
+    // Load the header, take the balances from the checkpoint plus the rows
+    // appended after it and defer the rest of the rows to ensureHistory().
+    // False (nothing changed) without a checkpoint whose rows the file still
+    // starts with. Requires SaveFileLock.
+    bool loadFromCheckpointLocked(const string &filename) {
+        SaveCheckpoint ck;
+        SaveFileSync st;
+        string headerText;
+        if (!readSaveCheckpoint(filename, ck) || !readSaveFileState(filename, st, &headerText, false)) return false;
+        const uintmax_t rowsBytes = st.size - st.txsOffset;
+        if (rowsBytes < ck.rowsBytes) return false;
+        const bool sameFile = st.size == ck.fileSize && (int64_t)st.mtime.time_since_epoch().count() == ck.fileMtime
+            && fileInode(filename) == ck.fileInode;
+        if (!sameFile) {
+            FIN_TRACE_SCOPE("verify checkpoint rows");
+            uint64_t rowsHash = 0;
+            if (!hashFileRange(filename, st.txsOffset, ck.rowsBytes, rowsHash) || rowsHash != ck.rowsHash) return false;
+        }
+        if (!hashFileRange(filename, st.txsOffset + ck.rowsBytes, rowsBytes - ck.rowsBytes, st.rowsHash, ck.rowsHash)) return false;
+
+        vector<Transaction> appended;
+        if (rowsBytes > ck.rowsBytes) {
+            FIN_TRACE_SCOPE("read appended rows");
+            ifstream ifs(filename, ios::in | ios::binary);
+            ifs.seekg((std::streamoff)(st.txsOffset + ck.rowsBytes));
+            string line;
+            while (getline(ifs, line)) {
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                Transaction t;
+                if (parseSavedTxLine(line, t)) appended.push_back(std::move(t));
+            }
+        }
+
+        std::istringstream hs(headerText);
+        parseSaveStream(hs);
+        FIN_TRACE_SCOPE("apply checkpoint balances");
+        // The header's BALANCE and CATEGORIES are replaced by the derived values
+        balance = ck.balance;
+        categoryBalances.clear();
+        for (auto &c : ck.categories) {
+            const string nk = normalizeKey(c.first);
+            categoryBalances[nk] = c.second;
+            if (displayNames.find(nk) == displayNames.end()) displayNames[nk] = c.first;
+        }
+        for (auto &t : appended) {
+            const string nk = normalizeKey(t.category);
+            balance += t.amount;
+            categoryBalances[nk] += t.amount;
+            if (displayNames.find(nk) == displayNames.end()) displayNames[nk] = t.category;
+        }
+        for (auto &p : allocationPct) categoryBalances.insert({p.first, 0.0});
+
+        deferredHistory = DeferredHistory{filename, rowsBytes, st.rowsHash};
+        st.path = filename;
+        st.generation = fileSync.generation + 1;
+        fileSync = st;   // rows stays 0 until the history is parsed
+        return true;
+    }
+
+    // Parse the rows deferred by a checkpoint load; no-op once they are
+    // in. Rows merged from other instances meanwhile stay after them. Writers
+    // replace the save file by rename, so the range is read without
+    // SaveFileLock; if the file no longer holds it, the file is reloaded
+    // under the lock. Requires the account mutex, and not SaveFileLock
+    // (ensureHistoryLocked is for callers holding it).
+    void ensureHistory() {
+        if (!deferredHistory) return;
+        const string file = deferredHistory->file;
+        if (parseDeferredHistory()) return;
+        SaveFileLock fileLock(file);
+        loadFromFileLocked(file, false);
+    }
+
+    // ensureHistory for callers already holding SaveFileLock
+    void ensureHistoryLocked() {
+        if (!deferredHistory) return;
+        const string file = deferredHistory->file;
+        if (!parseDeferredHistory()) loadFromFileLocked(file, false);
+    }
+
+    // Move the deferred rows into txs; false (with a warning) when the file
+    // no longer holds them and has to be reloaded
+    bool parseDeferredHistory() {
+        const DeferredHistory h = std::move(*deferredHistory);
+        deferredHistory.reset();
+        FIN_TRACE_SCOPE("read deferred rows");
+        string buf((size_t)h.bytes, '\0');
+        bool intact = false;
+        {
+            ifstream ifs(h.file, ios::in | ios::binary);
+            ifs.seekg((std::streamoff)fileSync.txsOffset);
+            intact = ifs && (h.bytes == 0 || ifs.read(&buf[0], (std::streamsize)h.bytes));
+        }
+        if (!intact || fileSync.path != h.file || fnv1a(buf.data(), buf.size()) != h.rowsHash) {
+            cerr << "Warning: " << h.file << " changed before its transactions were read; reloading it\n";
+            return false;
+        }
+
+        FIN_TRACE_NEXT("parse deferred rows");
+        vector<Transaction> history;
+        for (size_t pos = 0; pos < buf.size();) {
+            size_t nl = buf.find('\n', pos);
+            if (nl == string::npos) nl = buf.size();
+            string line = buf.substr(pos, nl - pos);
+            pos = nl + 1;
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            Transaction t;
+            if (parseSavedTxLine(line, t)) history.push_back(std::move(t));
+        }
+        snapshotChunks.clear(); snapshotRows = 0;
+        txs.insert(txs.begin(), std::make_move_iterator(history.begin()), std::make_move_iterator(history.end()));
+        fileSync.rows += history.size();
+        ++fileSync.generation;
+        FIN_TRACE_NEXT("recompute balances");
+        recomputeBalances(true, balance);   // the checkpoint's balance stands in for BALANCE
+        return true;
+    }
+
+    // Last n deferred rows (oldest first), read from the end of their byte range;
+    // empty once the history is parsed
+    vector<Transaction> deferredTail(size_t n) const {
+        vector<Transaction> out;
+        if (!deferredHistory || n == 0) return out;
+        const uintmax_t begin = fileSync.txsOffset, end = begin + deferredHistory->bytes;
+        ifstream ifs(deferredHistory->file, ios::in | ios::binary);
+        for (uintmax_t window = 4096; ifs; window *= 4) {
+            const uintmax_t from = end - min(window, end - begin);
+            string buf((size_t)(end - from), '\0');
+            ifs.seekg((std::streamoff)from);
+            if (!buf.empty() && !ifs.read(&buf[0], (std::streamsize)buf.size())) break;
+            if (from != begin && (size_t)count(buf.begin(), buf.end(), '\n') <= n) continue;
+            // Without the start of the range the first line may be partial
+            vector<string> lines;
+            size_t pos = from == begin ? 0 : buf.find('\n') + 1;
+            while (pos < buf.size()) {
+                size_t nl = buf.find('\n', pos);
+                if (nl == string::npos) nl = buf.size();
+                lines.push_back(buf.substr(pos, nl - pos));
+                pos = nl + 1;
+            }
+            for (size_t i = lines.size() > n ? lines.size() - n : 0; i < lines.size(); ++i) {
+                if (!lines[i].empty() && lines[i].back() == '\r') lines[i].pop_back();
+                Transaction t;
+                if (parseSavedTxLine(lines[i], t)) out.push_back(std::move(t));
+            }
+            break;
+        }
+        return out;
+    }
+
+    // Replace the whole account state with the contents of a save file
+    void parseSaveStream(std::istream &ifs) {
         string line;
         enum Section { None, SettingsSec, InterestSec, Alloc, Cats, Scheds, Txs } sec = None;
         allocationPct.clear(); categoryBalances.clear(); schedules.clear(); txs.clear(); displayNames.clear(); interestMap.clear();
+        snapshotChunks.clear(); snapshotRows = 0;
+        categoryIndex.clear();
+        deferredHistory.reset();
 
         double savedBalance = 0.0;
         bool hadSavedBalance = false;
+        FIN_TRACE_SCOPE("parse header");
 
         // default settings if not present in file
         settings.autoSave = false;
@@ -805,12 +2042,13 @@ struct Account {
         settings.language = "EN";
 
         while (getline(ifs, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
             if (line == "SETTINGS") { sec = SettingsSec; continue; }
             if (line == "INTERESTS") { sec = InterestSec; continue; }
             if (line == "ALLOCATIONS") { sec = Alloc; continue; }
             if (line == "CATEGORIES") { sec = Cats; continue; }
             if (line == "SCHEDULES") { sec = Scheds; continue; }
-            if (line == "TXS") { sec = Txs; continue; }
+            if (line == "TXS") { sec = Txs; FIN_TRACE_NEXT("parse rows"); continue; }
             if (line.rfind("BALANCE ", 0) == 0) {
                 try { savedBalance = stod(line.substr(8)); hadSavedBalance = true; } catch (...) { cerr << "Warning: invalid BALANCE value.\n"; }
             } else {
@@ -900,25 +2138,22 @@ struct Account {
                         schedules.push_back(s);
                     } else cerr << "Warning: invalid schedule line: " << line << "\n";
                 } else if (sec == Txs) {
-                    auto parts = splitEscaped(line);
-                    if (parts.size() >= 4) {
-                        Transaction t;
-                        chrono_tp dt;
-                        if (!tryParseDate(parts[0], dt)) { cerr << "Warning: invalid tx date '" << parts[0] << "'. Skipping tx.\n"; continue; }
-                        t.date = dt;
-                        try { t.amount = stod(parts[1]); } catch (...) { cerr << "Warning: invalid tx amount\n"; continue; }
-                        t.category = parts[2];
-                        t.note = parts[3];
+                    Transaction t;
+                    if (parseSavedTxLine(line, t)) {
                         txs.push_back(t);
                         string nk = normalizeKey(t.category);
                         if (displayNames.find(nk) == displayNames.end()) displayNames[nk] = t.category;
-                    } else cerr << "Warning: invalid tx line: " << line << "\n";
+                    }
                 }
             }
         }
-        ifs.close();
+        FIN_TRACE_NEXT("recompute balances");
+        recomputeBalances(hadSavedBalance, savedBalance);
+    }
 
-        // Recompute categoryBalances from transactions to ensure consistency.
+    // Recompute categoryBalances and balance from txs; categories without rows
+    // keep their saved amount, as does the balance when there are no rows
+    void recomputeBalances(bool hadSavedBalance, double savedBalance) {
         map<string,double> recomputedCats;
         for (auto &t : txs) {
             string nk = normalizeKey(t.category);
@@ -948,10 +2183,6 @@ struct Account {
             }
             balance = computedBalance;
         }
-
-        // UI message: show in user's language loaded message in English (save file not localized)
-        cout << "Loaded from " << filename << "\n";
-        return true;
     }
 };
 
@@ -964,44 +2195,648 @@ struct Account {
 
 #include "../config/i18n.h"
 
-// tr(): Get translated message for a key in user's language
-// If message contains {SAVE_FILENAME} placeholder, substitutes it at runtime
-// Falls back to message key itself if translation not found
-static inline string tr(const Settings &s, const string &id) {
-    // Delegate to header-only i18n loader. If message contains placeholder {SAVE_FILENAME}
-    // we'll substitute it here at runtime (so the header doesn't need to know about SAVE_FILENAME).
-    string out = i18n.get(s.language, id);
-    if (out.empty()) return id;
-    const string placeholder = "{SAVE_FILENAME}";
-    size_t pos = 0;
-    while ((pos = out.find(placeholder, pos)) != string::npos) {
-        const string fname = defaultSavePath();
-        out.replace(pos, placeholder.size(), fname);
-        pos += fname.size();
+// ---- Message templates ----
+// Messages may contain placeholders such as {NAME} or {COUNT}. Each message is
+// parsed once, when its catalog table is built, into literal segments and
+// placeholder slots; formatting then appends the pieces to an output buffer
+// instead of searching and splicing a copy of the text.
+enum class Slot : uint8_t { SAVE_FILENAME, NAME, DATE, PCT, TOTAL, LANG, FREQ, RATE, LINE, COUNT };
+static constexpr std::string_view kSlotNames[] = {
+    "SAVE_FILENAME", "NAME", "DATE", "PCT", "TOTAL", "LANG", "FREQ", "RATE", "LINE", "COUNT"
+};
+static constexpr size_t kSlotCount = sizeof(kSlotNames) / sizeof(kSlotNames[0]);
+
+// Values for the slots of one message. Strings are kept as views, so pass
+// values that outlive the format call (temporaries in the same expression are
+// fine); numbers are formatted into the object itself. {SAVE_FILENAME}
+// defaults to defaultSavePath(); any other slot without a value is left as
+// written.
+class MsgArgs {
+public:
+    MsgArgs &set(Slot slot, std::string_view text) {
+        values[(size_t)slot] = text;
+        present[(size_t)slot] = true;
+        return *this;
+    }
+    template <typename Int, typename = std::enable_if_t<std::is_integral_v<Int>>>
+    MsgArgs &set(Slot slot, Int n) {
+        char *buf = numbers[(size_t)slot];
+        auto res = std::to_chars(buf, buf + sizeof numbers[0], n);
+        return set(slot, std::string_view(buf, (size_t)(res.ptr - buf)));
+    }
+    // Fixed-point with the given number of decimals (same text as fixed << setprecision)
+    MsgArgs &set(Slot slot, double v, int decimals) {
+        char *buf = numbers[(size_t)slot];
+        int n = snprintf(buf, sizeof numbers[0], "%.*f", decimals, v);
+        return set(slot, std::string_view(buf, (size_t)std::clamp(n, 0, (int)sizeof numbers[0] - 1)));
+    }
+    bool get(Slot slot, std::string_view &out) const {
+        if (present[(size_t)slot]) { out = values[(size_t)slot]; return true; }
+        if (slot == Slot::SAVE_FILENAME) { out = defaultSavePath(); return true; }
+        return false;
+    }
+
+private:
+    std::array<std::string_view, kSlotCount> values{};
+    std::array<bool, kSlotCount> present{};
+    char numbers[kSlotCount][48];
+};
+
+class MessageTemplate {
+public:
+    MessageTemplate() = default;
+    explicit MessageTemplate(std::string_view text) : whole(text) {
+        size_t lit = 0;
+        for (size_t open = text.find('{'); open != std::string_view::npos; open = text.find('{', open + 1)) {
+            size_t close = text.find('}', open + 1);
+            if (close == std::string_view::npos) break;
+            auto name = text.substr(open + 1, close - open - 1);
+            auto it = std::find(std::begin(kSlotNames), std::end(kSlotNames), name);
+            if (it == std::end(kSlotNames)) continue;   // not ours: stays literal text
+            segments.push_back({text.substr(lit, open - lit), (int)(it - std::begin(kSlotNames))});
+            lit = close + 1;
+            open = close;
+        }
+        if (!segments.empty()) segments.push_back({text.substr(lit), -1});
+    }
+
+    bool hasSlots() const { return !segments.empty(); }
+    bool uses(Slot slot) const {
+        for (auto &seg : segments) if (seg.slot == (int)slot) return true;
+        return false;
+    }
+
+    void formatTo(std::string &out, const MsgArgs &args) const {
+        if (segments.empty()) { out.append(whole); return; }
+        for (auto &seg : segments) {
+            out.append(seg.literal);
+            if (seg.slot < 0) continue;
+            std::string_view v;
+            if (args.get((Slot)seg.slot, v)) out.append(v);
+            else { out += '{'; out.append(kSlotNames[seg.slot]); out += '}'; }
+        }
+    }
+
+private:
+    struct Segment {
+        std::string_view literal;   // text before the slot
+        int slot;                   // Slot index, -1 for the trailing literal
+    };
+    std::string_view whole;
+    std::vector<Segment> segments;  // empty when the text has no placeholders
+};
+
+// ---- Compiled message catalog ----
+// kCatalog (config/messages_gen.h) has every message with fallback applied, so
+// a lookup is an array index. Locale files loaded at runtime are a patch layer
+// on top: the first lookup in a language builds a table of views that prefers
+// runtime text of that language, then the compiled text of that language, then
+// runtime EN / LANGFALLBACK, then compiled EN. Every message is parsed into a
+// MessageTemplate at the same time, and messages containing {SAVE_FILENAME}
+// get their plain text pre-formatted. Tables are per thread (daemon clients
+// translate concurrently) and rebuilt when i18n.generation changes. Each table
+// is built from one FlatLocales snapshot and keeps it. Inside a LocaleFrame
+// tables are not swapped, so one render never mixes text from before and after
+// a reload; replaced tables live until the next swap, so views returned just
+// before a reload stay valid.
+class MessageCatalog {
+public:
+    int frameDepth = 0;   // open LocaleFrames on this thread
+
+    std::string_view get(const string &language, Msg id) {
+        return table(language).views[(size_t)id];
+    }
+
+    const MessageTemplate &templateFor(const string &language, Msg id) {
+        return table(language).templates[(size_t)id];
+    }
+
+    // Switch to the current locale generation (tables are rebuilt on next use)
+    void sync() {
+        i18n.ensureLoaded();
+        const unsigned long generation = i18n.generation.load(std::memory_order_acquire);
+        if (builtGeneration == generation) return;
+        previous.clear();
+        previous.swap(tables);
+        last = nullptr;
+        builtGeneration = generation;
     }
+
+    // i18n.generation the tables tr() reads right now come from (pinned inside a
+    // LocaleFrame, so it can lag behind the global counter)
+    unsigned long generation() {
+        if (frameDepth == 0) sync();
+        return builtGeneration;
+    }
+
+private:
+    struct Table {
+        string language;
+        std::array<std::string_view, kMsgCount> views;
+        std::array<MessageTemplate, kMsgCount> templates;
+        std::deque<string> owned;   // pre-formatted texts the views point into
+        std::shared_ptr<const FlatLocales> locales;   // runtime texts the views point into
+    };
+    std::deque<Table> tables;       // deque: stable addresses for `last`
+    std::deque<Table> previous;     // tables of the last generation
+    Table *last = nullptr;
+    unsigned long builtGeneration = ~0ul;
+
+    Table &table(const string &language) {
+        if (frameDepth == 0) sync();
+        if (!last || last->language != language) {
+            last = nullptr;
+            for (auto &t : tables) if (t.language == language) { last = &t; break; }
+            if (!last) last = &build(language);
+        }
+        return *last;
+    }
+
+    Table &build(const string &language) {
+        tables.emplace_back();
+        Table &t = tables.back();
+        t.language = language;
+        string code = language;
+        for (auto &ch : code) ch = (char)toupper((unsigned char)ch);
+        auto lang = std::find(std::begin(kCatalogLangs), std::end(kCatalogLangs), code);
+        const bool compiled = lang != std::end(kCatalogLangs);
+        const std::string_view *base = kCatalog[compiled ? (size_t)(lang - std::begin(kCatalogLangs)) : kCatalogFallbackLang];
+        i18n.ensureLanguage(code);   // languages other than the save file's are merged on first use
+        t.locales = i18n.flatLocales();
+        for (size_t i = 0; i < kMsgCount; ++i) {
+            bool native = false;
+            std::string_view rt;   // already EN / LANGFALLBACK resolved
+            if (t.locales) rt = t.locales->lookup(code, kMsgIds[i], &native);
+            std::string_view v;
+            if (native) v = rt;
+            else if (compiled) v = base[i];
+            else if (!rt.empty()) v = rt;
+            else v = base[i];
+            t.templates[i] = MessageTemplate(v);
+            if (t.templates[i].uses(Slot::SAVE_FILENAME)) {
+                string text;
+                t.templates[i].formatTo(text, MsgArgs());
+                t.owned.push_back(std::move(text));
+                v = t.owned.back();
+            }
+            t.views[i] = v;
+        }
+        return t;
+    }
+};
+
+static thread_local MessageCatalog gMessages;
+
+// LocaleFrame: pins this thread's message tables for one render (a menu pass,
+// a TUI frame) so a locale edit applied meanwhile shows up whole next time.
+struct LocaleFrame {
+    LocaleFrame() { if (gMessages.frameDepth++ == 0) gMessages.sync(); }
+    ~LocaleFrame() { --gMessages.frameDepth; }
+    LocaleFrame(const LocaleFrame &) = delete;
+    LocaleFrame &operator=(const LocaleFrame &) = delete;
+};
+
+// tr(): translated message for a compiled message id; the key itself if no locale has it
+static inline std::string_view tr(const Settings &s, Msg id) {
+    FIN_PERF_SAMPLED_SCOPE(Translate);
+    std::string_view v = gMessages.get(s.language, id);
+    return v.empty() ? kMsgIds[(size_t)id] : v;
+}
+
+// formatTo(): append a translated message with its placeholders filled from args
+static inline void formatTo(std::string &out, const Settings &s, Msg id, const MsgArgs &args) {
+    const MessageTemplate &t = gMessages.templateFor(s.language, id);
+    if (t.hasSlots()) t.formatTo(out, args);
+    else out.append(tr(s, id));
+}
+
+static inline string formatMsg(const Settings &s, Msg id, const MsgArgs &args) {
+    string out;
+    formatTo(out, s, id, args);
     return out;
 }
 
-// Finance 3.0: also scan locale subfolders for *.lang files.
-static inline void loadLocalesFromSubfolders(const std::filesystem::path &root) {
+// --locale-stats: memory used by the flattened locale tables and how much interning saves
+static int printLocaleStats() {
+    auto f = i18n.flatLocales();
+    if (!f || f->codes.empty()) { cout << "No locales loaded.\n"; return 1; }
+    const size_t keys = f->keys.size();
+    // Which rows use each text natively (to tell shared texts from unique ones)
+    vector<int> nativeUsers(f->texts.size(), 0);
+    for (size_t r = 0; r < f->codes.size(); ++r) {
+        for (size_t k = 0; k < keys; ++k) {
+            uint32_t e = f->entries[r * keys + k];
+            if (e != FlatLocales::kMissing && !(e & FlatLocales::kInherited)) ++nativeUsers[e];
+        }
+    }
+    size_t keyBytes = 0, textBytes = 0, referenced = 0;
+    for (auto &k : f->keys) keyBytes += k.size();
+    for (auto &t : f->texts) textBytes += t.size();
+    cout << "Locales: " << f->codes.size() << " x " << keys << " keys (" << keyBytes << " key bytes, shared)\n";
+    for (size_t r = 0; r < f->codes.size(); ++r) {
+        size_t entries = 0, native = 0, nativeBytes = 0, sharedBytes = 0, rowBytes = 0;
+        for (size_t k = 0; k < keys; ++k) {
+            uint32_t e = f->entries[r * keys + k];
+            if (e == FlatLocales::kMissing) continue;
+            ++entries;
+            const size_t len = f->texts[e & ~FlatLocales::kInherited].size();
+            rowBytes += len;
+            if (e & FlatLocales::kInherited) continue;
+            ++native;
+            nativeBytes += len;
+            if (nativeUsers[e] > 1) sharedBytes += len;
+        }
+        referenced += rowBytes;
+        cout << "  " << left << setw(13) << f->codes[r] << right << entries << " entries (" << native << " own, "
+             << entries - native << " via fallback), table " << keys * sizeof(uint32_t) << " B, own text "
+             << nativeBytes << " B (" << sharedBytes << " B identical in another locale), resolves to " << rowBytes << " B\n";
+    }
+    const size_t tables = f->entries.size() * sizeof(uint32_t) + (f->keys.size() + f->texts.size()) * sizeof(std::string_view);
+    cout << "Interned texts: " << f->texts.size() << " distinct, " << textBytes << " B for " << referenced
+         << " B of resolved entries (" << (referenced ? 100 * (referenced - textBytes) / referenced : 0) << "% deduplicated)\n";
+    if (f->mapping) cout << "Total: mapped bundle " << f->mappedBytes << " B + tables " << tables << " B\n";
+    else cout << "Total: arena " << f->arena.size() << " B + tables " << tables << " B\n";
+    return 0;
+}
+
+// ---- Message catalog generator (--gen-catalog) ----
+// Turns config/locales/*.lang into config/messages_gen.h: an enum of message
+// ids and one constexpr table per language with the EN / LANGFALLBACK fallback
+// already applied, so tr(settings, Msg::key) needs no hashing at runtime.
+// Re-run after adding keys to the .lang files (keys must be C++ identifiers);
+// code can only name a key once it has a Msg id.
+
+// C++ string literal for arbitrary bytes (octal escapes keep the output ASCII)
+static string catalogLiteral(const string &text) {
+    string out = "\"";
+    for (unsigned char c : text) {
+        if (c == '\\' || c == '"') { out += '\\'; out += (char)c; }
+        else if (c == '\n') out += "\\n";
+        else if (c < 0x20 || c >= 0x7f) {
+            char buf[8];
+            snprintf(buf, sizeof buf, "\\%03o", c);
+            out += buf;
+        } else out += (char)c;
+    }
+    return out + "\"";
+}
+
+static int runGenCatalog(const string &outArg) {
+    std::filesystem::path dir = "config/locales";
+    if (!std::filesystem::is_directory(dir)) dir = std::filesystem::path(__FILE__).parent_path().parent_path() / "config" / "locales";
+    if (!std::filesystem::is_directory(dir)) { cerr << "gen-catalog: cannot find config/locales\n"; return 1; }
+    const std::filesystem::path out = outArg.empty() ? dir.parent_path() / "messages_gen.h" : std::filesystem::path(outArg);
+
+    // Same merge rules as I18n discovery; base files before _extra files
+    map<string, vector<std::filesystem::path>> filesByCode;
+    for (auto &entry : std::filesystem::directory_iterator(dir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".lang")
+            filesByCode[I18n::localeCodeForFile(entry.path())].push_back(entry.path());
+    }
+    map<string, I18n::LocaleMap> locales;
+    for (auto &kv : filesByCode) {
+        auto &files = kv.second;
+        sort(files.begin(), files.end(), I18n::localeFileOrder);
+        I18n::LocaleMap merged;
+        for (auto &f : files) I18n::parseLocaleFile(f.string(), merged);
+        vector<string> missing;
+        if (!i18n.isLocaleValid(merged, missing)) { cerr << "gen-catalog: skipping invalid locale " << kv.first << "\n"; continue; }
+        locales[kv.first] = std::move(merged);
+    }
+    if (!locales.count(i18n.fallback)) { cerr << "gen-catalog: no " << i18n.fallback << " locale in " << dir.string() << "\n"; return 1; }
+
+    set<string> keySet;
+    for (auto &l : locales) for (auto &kv : l.second) keySet.insert(kv.first);
+    vector<string> keys(keySet.begin(), keySet.end());
+    for (auto &k : keys) {
+        bool ident = !k.empty() && !isdigit((unsigned char)k[0]);
+        for (char c : k) ident = ident && (isalnum((unsigned char)c) || c == '_');
+        if (!ident) { cerr << "gen-catalog: key '" << k << "' is not a valid identifier\n"; return 1; }
+    }
+
+    // Resolve exactly like I18n::get: requested, then EN, then LANGFALLBACK
+    auto lookup = [&](const string &code, const string &key) -> const string * {
+        auto it = locales.find(code);
+        if (it == locales.end()) return nullptr;
+        auto v = it->second.find(key);
+        return (v == it->second.end() || v->second.empty()) ? nullptr : &v->second;
+    };
+    std::ostringstream os;
+    os << "// Generated by `finance --gen-catalog` from config/locales/*.lang - do not edit.\n"
+       << "// Edit the .lang files and regenerate instead.\n"
+       << "#pragma once\n\n#include <cstddef>\n#include <string_view>\n\n";
+    os << "enum class Msg : unsigned short {\n";
+    for (auto &k : keys) os << "    " << k << ",\n";
+    os << "};\n\n";
+    os << "constexpr std::size_t kMsgCount = " << keys.size() << ";\n";
+    os << "constexpr std::size_t kCatalogLangCount = " << locales.size() << ";\n";
+    size_t fallbackIdx = (size_t)distance(locales.begin(), locales.find(i18n.fallback));
+    os << "constexpr std::size_t kCatalogFallbackLang = " << fallbackIdx << ";\n\n";
+    os << "// Message keys, sorted; kMsgIds[(size_t)Msg::x] == \"x\"\n";
+    os << "constexpr std::string_view kMsgIds[kMsgCount] = {\n";
+    for (auto &k : keys) os << "    \"" << k << "\",\n";
+    os << "};\n\n";
+    os << "// Language codes as I18n stores them (uppercase), sorted\n";
+    os << "constexpr std::string_view kCatalogLangs[kCatalogLangCount] = {";
+    for (auto &l : locales) os << " \"" << l.first << "\",";
+    os << " };\n\n";
+    os << "// kCatalog[lang][msg]: text with fallback applied; empty if no locale has it\n";
+    os << "constexpr std::string_view kCatalog[kCatalogLangCount][kMsgCount] = {\n";
+    for (auto &l : locales) {
+        os << "    { // " << l.first << "\n";
+        for (auto &k : keys) {
+            const string *v = lookup(l.first, k);
+            if (!v) v = lookup(i18n.fallback, k);
+            if (!v) v = lookup(i18n.fallbackFileCode, k);
+            os << "        " << catalogLiteral(v ? *v : string()) << ",\n";
+        }
+        os << "    },\n";
+    }
+    os << "};\n";
+
+    ofstream ofs(out, ios::out | ios::trunc | ios::binary);
+    if (!ofs || !(ofs << os.str())) { cerr << "gen-catalog: cannot write " << out.string() << "\n"; return 1; }
+    cout << "Wrote " << out.string() << ": " << keys.size() << " messages x " << locales.size() << " languages\n";
+    return 0;
+}
+
+// ---- Locale bundle (--compile-locales) ----
+// Scans the locale folders like a normal start, plus the machine-translated
+// samples (lowest precedence), and writes the flattened tables as one binary
+// bundle that later starts map instead of scanning. Re-run after editing
+// .lang files, or delete the bundle to go back to scanning.
+static int runCompileLocales(const string &outArg) {
+    I18n builder;   // no bundlePath: always scans, even if a bundle exists
+    builder.extraRoots.push_back("config/Machinetranslatedsamples");
+    builder.reload();
+    auto f = builder.flatLocales();
+    if (!f || f->codes.empty()) { cerr << "compile-locales: no valid locale found\n"; return 1; }
+    const string out = outArg.empty() ? string("config/locales.bundle") : outArg;
+    string err;
+    if (!I18n::writeBundle(*f, out, (uint32_t)builder.localeFileCount, err)) { cerr << "compile-locales: " << err << "\n"; return 1; }
     std::error_code ec;
-    if (!std::filesystem::exists(root, ec) || !std::filesystem::is_directory(root, ec)) return;
-    bool loadedSubfolders = false;
-    std::filesystem::recursive_directory_iterator it(
-        root,
-        std::filesystem::directory_options::skip_permission_denied,
-        ec
-    );
-    for (; it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
-        if (ec) { ec.clear(); continue; }
-        if (!it->is_directory(ec)) continue;
-        const auto &dir = it->path();
-        if (dir == root) continue;
-        i18n.tryLoadLocalesFolder(dir.string());
-        loadedSubfolders = true;
-    }
-    // Re-merge root in case base locale files live in subfolders.
-    if (loadedSubfolders) i18n.tryLoadLocalesFolder(root.string());
+    cout << "Wrote " << out << ": " << f->codes.size() << " locales x " << f->keys.size() << " keys from "
+         << builder.localeFileCount << " files (" << std::filesystem::file_size(out, ec) << " bytes)\n";
+    return 0;
+}
+
+// ============================================================
+// SECTION 5C: BACKGROUND SAVING & AUTO-SAVE GROUP COMMIT
+// ============================================================
+// All saves from the interactive loop go through BackgroundSaver:
+// - Auto-save (settings.autoSave) is a group commit: menu actions only mark
+//   the account dirty and the writer flushes at most once per maxDelay after
+//   the first pending change, or as soon as maxChanges have accumulated.
+// - Manual saves (menu 7) hand over a snapshot taken on the UI thread.
+// The writer holds accMutex only while taking a snapshot (cheap, see
+// Account::snapshot), never while serializing, so the prompt stays responsive
+// during long saves. The UI thread releases accMutex whenever it waits for
+// input (see InputWait), also at the prompts inside a menu action, so a due
+// flush is not held back until the action ends; merging another instance's
+// changes into the account does wait for that (see setActionRunning). stop() drains queued saves and flushes pending changes,
+// so a clean exit never loses data. Writes happen under SaveFileLock; if
+// another instance changed the file since the snapshot was taken, its rows are
+// merged first and a fresh snapshot is written instead.
+
+class BackgroundSaver {
+public:
+    using clock = chrono::steady_clock;
+
+    // Result of a finished manual save, reported back to the UI thread
+    struct Notice {
+        bool ok;
+        string file;
+    };
+
+    BackgroundSaver(Account &account, std::mutex &accountMutex, string path,
+                    chrono::milliseconds delay = chrono::milliseconds(2000), int changes = 20)
+        : acc(account), accMutex(accountMutex), savePath(std::move(path)), maxDelay(delay), maxChanges(changes) {}
+
+    ~BackgroundSaver() { stop(); }
+
+    BackgroundSaver(const BackgroundSaver &) = delete;
+    BackgroundSaver &operator=(const BackgroundSaver &) = delete;
+
+    void start() {
+        if (worker.joinable()) return;
+        stopping = false;
+        worker = std::thread([this]() { run(); });
+    }
+
+    // Record one mutating action; cheap, never touches the disk
+    void markDirty() {
+        {
+            std::lock_guard<std::mutex> g(m);
+            if (pending == 0) firstDirty = clock::now();
+            ++pending;
+        }
+        cv.notify_one();
+    }
+
+    // Queue a manual save of an already-taken snapshot. It covers every change
+    // made so far, so pending auto-save work is folded into it.
+    void saveAsync(AccountSnapshot snap) {
+        {
+            std::lock_guard<std::mutex> g(m);
+            pending = 0;
+            jobs.push_back(std::move(snap));
+        }
+        cv.notify_one();
+    }
+
+    // Wait until no save is queued or running; false on timeout
+    bool waitIdle(chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lk(m);
+        return idleCv.wait_for(lk, timeout, [&]() { return jobs.empty() && !writing; });
+    }
+
+    // Finished manual saves since the last call (for UI messages)
+    vector<Notice> takeNotices() {
+        std::lock_guard<std::mutex> g(m);
+        vector<Notice> out;
+        out.swap(notices);
+        return out;
+    }
+
+    // Stop the writer, finish queued saves and flush anything still pending.
+    // The caller must not hold accMutex.
+    void stop() {
+        setActionRunning(false);
+        {
+            std::lock_guard<std::mutex> g(m);
+            stopping = true;
+        }
+        cv.notify_one();
+        if (worker.joinable()) worker.join();
+        bool flush;
+        {
+            std::lock_guard<std::mutex> g(m);
+            flush = pending > 0;
+            pending = 0;
+        }
+        if (flush && commit(nullptr)) ++flushes;
+    }
+
+    // Stop the writer and drop queued saves and pending changes, so nothing
+    // recreates a save file that is being deleted. A save already running
+    // finishes first. The caller must not hold accMutex.
+    void discard() {
+        setActionRunning(false);
+        {
+            std::lock_guard<std::mutex> g(m);
+            stopping = true;
+            jobs.clear();
+            pending = 0;
+        }
+        cv.notify_one();
+        if (worker.joinable()) worker.join();
+    }
+
+    // Set by the UI thread around each menu action. While one runs, the UI
+    // keeps references into the account across its prompts, so a save that
+    // would merge another instance's changes into it waits for the action to
+    // end; saves that only take a snapshot go ahead.
+    void setActionRunning(bool running) {
+        actionRunning.store(running);
+        if (!running) actionCv.notify_all();
+    }
+
+    int flushCount() const { return flushes.load(); }
+
+private:
+    Account &acc;
+    std::mutex &accMutex;
+    string savePath;
+    chrono::milliseconds maxDelay;
+    int maxChanges;
+
+    std::thread worker;
+    std::mutex m;
+    std::condition_variable cv, idleCv;
+    int pending = 0;
+    clock::time_point firstDirty;
+    bool stopping = false;
+    bool writing = false;
+    std::deque<AccountSnapshot> jobs;
+    vector<Notice> notices;
+    std::atomic<int> flushes{0};
+    std::atomic<bool> actionRunning{false};
+    std::condition_variable actionCv;   // waited on with accMutex
+
+    // Write snap (or, if null, a snapshot taken now) under the save-file lock.
+    // A snapshot older than the last merge, or a file another instance changed,
+    // needs the account: drop the file lock, take accMutex first (lock order),
+    // merge their rows and snapshot again.
+    bool commit(const AccountSnapshot *snap) {
+        SaveFileLock fileLock(savePath);
+        if (snap && snap->syncGeneration == acc.fileSync.generation && !acc.saveFileChangedLocked(savePath))
+            return acc.writeSnapshotLocked(*snap, savePath);
+        fileLock.unlock();
+        std::unique_lock<std::mutex> g(accMutex);
+        fileLock.lock();
+        // The UI is at a prompt inside an action: do not merge under it
+        while (actionRunning.load() && acc.saveFileChangedLocked(savePath)) {
+            fileLock.unlock();
+            actionCv.wait_for(g, chrono::milliseconds(100));
+            fileLock.lock();
+        }
+        acc.mergeExternalChangesLocked(savePath, true);
+        AccountSnapshot fresh = acc.snapshot();
+        g.unlock();
+        return acc.writeSnapshotLocked(fresh, savePath);
+    }
+
+    void run() {
+        FIN_TRACE_THREAD("background saver");
+        std::unique_lock<std::mutex> lk(m);
+        while (true) {
+            cv.wait(lk, [&]() { return stopping || pending > 0 || !jobs.empty(); });
+            if (!jobs.empty()) {
+                AccountSnapshot snap = std::move(jobs.front());
+                jobs.pop_front();
+                writing = true;
+                lk.unlock();
+                bool ok = commit(&snap);
+                lk.lock();
+                writing = false;
+                notices.push_back({ok, savePath});
+                idleCv.notify_all();
+                continue;
+            }
+            if (stopping) return; // stop() flushes pending changes synchronously
+            // Debounce: wait for the deadline unless enough changes pile up
+            cv.wait_until(lk, firstDirty + maxDelay, [&]() {
+                return stopping || pending == 0 || pending >= maxChanges || !jobs.empty();
+            });
+            if (stopping || pending == 0 || !jobs.empty()) continue;
+            pending = 0;
+            writing = true;
+            lk.unlock();
+            if (commit(nullptr)) ++flushes;
+            lk.lock();
+            writing = false;
+            idleCv.notify_all();
+        }
+    }
+};
+
+// Measure UI-thread latency per mutating action: synchronous save-per-action
+// versus group commit. Uses a throw-away save file in the temp directory.
+static int runAutoSaveBench(int actions, int txCount) {
+    if (actions <= 0 || txCount < 0) { cerr << "bench-autosave: ACTIONS must be > 0 and TXS >= 0\n"; return 1; }
+    std::filesystem::path tmp = std::filesystem::temp_directory_path() / "finance_autosave_bench.txt";
+    Account acc;
+    chrono_tp base = today();
+    for (int i = 0; i < txCount; ++i) acc.addManualTransaction(addDays(base, -(i % 3650)), (i % 2 ? -1.0 : 1.0) * (i % 97), "Other", "bench");
+
+    auto percentile = [](vector<double> v, double q) {
+        sort(v.begin(), v.end());
+        return v[min(v.size() - 1, (size_t)(q * (double)(v.size() - 1) + 0.5))];
+    };
+    auto report = [&](const char *label, const vector<double> &v) {
+        cout << label << fixed << setprecision(3)
+             << " p50=" << percentile(v, 0.50) << "ms p99=" << percentile(v, 0.99)
+             << "ms max=" << *max_element(v.begin(), v.end()) << "ms\n";
+    };
+    const auto think = chrono::milliseconds(5); // simulated user input between actions
+
+    vector<double> syncLat, groupLat;
+    for (int i = 0; i < actions; ++i) {
+        acc.addManualTransaction(base, 1.0, "Other", "action");
+        auto t0 = chrono::steady_clock::now();
+        acc.saveToFile(tmp.string(), false);
+        syncLat.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count());
+        std::this_thread::sleep_for(think);
+    }
+
+    std::mutex accMutex;
+    int flushes = 0;
+    {
+        BackgroundSaver writer(acc, accMutex, tmp.string());
+        writer.start();
+        for (int i = 0; i < actions; ++i) {
+            // Latency covers waiting for the account lock, the action itself and commit bookkeeping
+            auto t0 = chrono::steady_clock::now();
+            {
+                std::lock_guard<std::mutex> g(accMutex);
+                acc.addManualTransaction(base, 1.0, "Other", "action");
+            }
+            writer.markDirty();
+            groupLat.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count());
+            std::this_thread::sleep_for(think);
+        }
+        writer.stop();
+        flushes = writer.flushCount();
+    }
+
+    cout << "actions=" << actions << " history=" << txCount << " txs\n";
+    report("sync save per action:", syncLat);
+    report("group commit:        ", groupLat);
+    cout << "group commit flushes=" << flushes << " (vs " << actions << " synchronous saves)\n";
+    std::error_code ec; std::filesystem::remove(tmp, ec);
+    std::filesystem::remove(tmp.string() + ".lock", ec);
+    std::filesystem::remove(checkpointPath(tmp.string()), ec);
+    return 0;
 }
 
 // ============================================================
@@ -1013,24 +2848,47 @@ static inline void loadLocalesFromSubfolders(const std::filesystem::path &root)
 // ---- ANSI terminal helpers (used by menu functions) ----
 
 #ifdef _WIN32
-inline void clearScreen() {
-    // Use simple ANSI clear screen + cursor home (works with alternate screen buffer)
-    // \033[2J = clear screen, \033[H = cursor to home (1,1)
-    cout << "\033[2J\033[H" << flush;
-}
+// Use simple ANSI clear screen + cursor home (works with alternate screen buffer)
+// \033[2J = clear screen, \033[H = cursor to home (1,1)
+inline const char *clearScreenSequence() { return "\033[2J\033[H"; }
 #else
+// noop on non-Windows
+inline const char *clearScreenSequence() { return ""; }
+#endif
+
 inline void clearScreen() {
-    // noop on non-Windows
+    const char *seq = clearScreenSequence();
+    if (*seq) cout << seq << flush;
 }
-#endif
 
 // Legacy name for compatibility
 inline void clearScreenAndScrollbackWindows() {
     clearScreen();
 }
 
+// The interactive loop holds accMutex (through this lock, set by main) while
+// an action runs. InputWait releases it for the duration of one read from the
+// terminal, so background saves run while the user sits at any prompt.
+static std::unique_lock<std::mutex> *gInputIdleLock = nullptr;
+
+struct InputWait {
+    InputWait() : released(gInputIdleLock && gInputIdleLock->owns_lock()) { if (released) gInputIdleLock->unlock(); }
+    ~InputWait() { if (released) gInputIdleLock->lock(); }
+    InputWait(const InputWait &) = delete;
+    InputWait &operator=(const InputWait &) = delete;
+private:
+    bool released;
+};
+
+// getline from the terminal with accMutex released (see InputWait)
+static inline bool readInputLine(string &out) {
+    InputWait wait;
+    return (bool)getline(cin, out);
+}
+
 // Read a line; if user presses ESC (ASCII 27) as a standalone input, signal cancel
 static inline bool getlineAllowEsc(string &out) {
+    InputWait wait;
     #ifdef _WIN32
     // If ESC is the first char in the buffer, treat as cancel
     int peekc = cin.peek();
@@ -1092,41 +2950,60 @@ inline void initConsoleUTF8() {
 }
 
 // ---- Menu displays ----
+// The main menu and the starting guide only change with the language or when
+// locales are (re)loaded, so both are rendered once into frames (including the
+// clear-screen prefix) and each redraw is a single write. Frames are keyed by
+// language code and the generation of this thread's message tables, which
+// tr() reads (not the live I18n::generation, which may be newer inside a
+// LocaleFrame).
+struct MenuFrameCache {
+    string language;
+    unsigned long generation = 0;
+    bool valid = false;
+    string menu;
+    string guide;
+
+    void refresh(const Settings &s) {
+        const unsigned long tablesGeneration = gMessages.generation();
+        if (valid && s.language == language && tablesGeneration == generation) return;
+        language = s.language;
+        generation = tablesGeneration;
+        valid = true;
+
+        menu = clearScreenSequence();
+        menu += "\n";
+        menu += tr(s, Msg::menu_title);
+        menu += "\n";
+        for (Msg k : {Msg::menu_H, Msg::menu_1, Msg::menu_2, Msg::menu_3, Msg::menu_4, Msg::menu_5, Msg::menu_6,
+                      Msg::menu_7, Msg::menu_8, Msg::menu_9, Msg::menu_10, Msg::menu_11}) {
+            menu += tr(s, k);
+            menu += "\n";
+        }
+        menu += tr(s, Msg::choice);
+
+        guide = clearScreenSequence();
+        for (Msg k : {Msg::starting_guide_title, Msg::guide_H, Msg::guide_1, Msg::guide_2, Msg::guide_3, Msg::guide_4,
+                      Msg::guide_5, Msg::guide_6, Msg::guide_7, Msg::guide_8, Msg::guide_9, Msg::guide_10, Msg::guide_11,
+                      Msg::guide_return, Msg::press_enter}) {
+            guide += tr(s, k);
+        }
+        guide += "\n";
+    }
+};
+static MenuFrameCache gMenuFrames;
+
 // Display starting guide with all features and how-to instructions
 void printStartingGuide(const Settings &s) {
-    clearScreenAndScrollbackWindows();
-    cout << tr(s, "starting_guide_title");
-    cout << tr(s, "guide_H");
-    cout << tr(s, "guide_1");
-    cout << tr(s, "guide_2");
-    cout << tr(s, "guide_3");
-    cout << tr(s, "guide_4");
-    cout << tr(s, "guide_5");
-    cout << tr(s, "guide_6");
-    cout << tr(s, "guide_7");
-    cout << tr(s, "guide_8");
-    cout << tr(s, "guide_9");
-    cout << tr(s, "guide_10");
-    cout << tr(s, "guide_return");
-    cout << tr(s, "press_enter") << "\n";
+    gMenuFrames.refresh(s);
+    cout.write(gMenuFrames.guide.data(), (std::streamsize)gMenuFrames.guide.size());
+    cout.flush();
 }
 
 // Display main menu with all available options
 void printMenu(const Settings &s) {
-    clearScreenAndScrollbackWindows();
-    cout << "\n" << tr(s, "menu_title") << "\n";
-    cout << tr(s, "menu_H") << "\n";
-    cout << tr(s, "menu_1") << "\n";
-    cout << tr(s, "menu_2") << "\n";
-    cout << tr(s, "menu_3") << "\n";
-    cout << tr(s, "menu_4") << "\n";
-    cout << tr(s, "menu_5") << "\n";
-    cout << tr(s, "menu_6") << "\n";
-    cout << tr(s, "menu_7") << "\n";
-    cout << tr(s, "menu_8") << "\n";
-    cout << tr(s, "menu_9") << "\n";
-    cout << tr(s, "menu_10") << "\n";
-    cout << tr(s, "choice");
+    gMenuFrames.refresh(s);
+    cout.write(gMenuFrames.menu.data(), (std::streamsize)gMenuFrames.menu.size());
+    cout.flush();
 }
 
 // ---- String utilities ----
@@ -1140,20 +3017,126 @@ static inline void trim_inplace(string &s) {
 // Prompt user to return to menu or save and exit
 // Returns true to continue, false to exit program
 static inline bool askReturnToMenuOrSave(Account &acc) {
-    cout << tr(acc.settings, "saved_exit_prompt");
+    cout << tr(acc.settings, Msg::saved_exit_prompt);
     string resp;
-    if (!getline(cin, resp)) return false;
+    if (!readInputLine(resp)) return false;
     trim_inplace(resp);
     if (resp.empty()) return true; // just return to menu
     if (resp[0] == 's' || resp[0] == 'S') {
         acc.saveToFile();
-        cout << tr(acc.settings, "saved_and_exiting") << "\n";
+        cout << tr(acc.settings, Msg::saved_and_exiting) << "\n";
         return false;
     }
     // For any other input, treat as return to menu (less likely to accidentally exit)
     return true;
 }
 
+// Tell the user what was picked up from other instances; false if nothing was
+static bool printExternalChange(const Account &acc, const Account::ExternalChange &change) {
+    if (change.rowsAdded) {
+        cout << formatMsg(acc.settings, Msg::external_rows_merged, MsgArgs().set(Slot::COUNT, change.rowsAdded)) << "\n";
+    }
+    if (change.headerAdopted) cout << tr(acc.settings, Msg::external_settings_merged) << "\n";
+    if (change.reloaded) cout << tr(acc.settings, Msg::external_reloaded) << "\n";
+    return change.rowsAdded || change.headerAdopted || change.reloaded;
+}
+
+// ---- Category picker helpers ----
+// Long category lists are cut after this many rows; "name?" searches the rest
+static const size_t kCategoryListLimit = 40;
+
+// Print the numbered category list (numbers index acc.categories().sorted())
+static void printCategoryList(Account &acc) {
+    const auto &cats = acc.categories().sorted();
+    cout << tr(acc.settings, Msg::existing_categories) << "\n";
+    size_t shown = min(cats.size(), kCategoryListLimit);
+    for (size_t i = 0; i < shown; ++i) {
+        cout << "  " << (i+1) << ". " << cats[i].first << "\n";
+    }
+    if (cats.size() > shown) {
+        cout << formatMsg(acc.settings, Msg::category_list_more, MsgArgs().set(Slot::COUNT, cats.size() - shown)) << "\n";
+    }
+    cout << tr(acc.settings, Msg::category_search_hint) << "\n";
+}
+
+// Print up to limit ranked matches as "  N. Name" (N = list number)
+static void printCategoryMatches(Account &acc, const string &query, size_t limit) {
+    auto matches = acc.categories().search(query, limit);
+    if (matches.empty()) { cout << tr(acc.settings, Msg::no_category_matches) << "\n"; return; }
+    for (auto &m : matches) cout << "  " << m.number << ". " << m.display << "\n";
+}
+
+// Read a category answer. While it ends with '?', list the matches for the text
+// before it and ask again. Returns false when the user cancels (Esc).
+static bool readCategoryInput(Account &acc, string &out, Msg promptKey, bool allowEsc = true) {
+    while (true) {
+        if (allowEsc) {
+            if (!getlineAllowEsc(out)) return false;
+        } else if (!readInputLine(out)) {
+            out.clear();
+        }
+        trim_inplace(out);
+        if (out.empty() || out.back() != '?') return true;
+        out.pop_back();
+        printCategoryMatches(acc, out, 10);
+        cout << tr(acc.settings, promptKey);
+    }
+}
+
+// After an unknown category name: suggest the closest existing ones, if any
+static void printCategorySuggestions(Account &acc, const string &input) {
+    auto matches = acc.categories().search(input, 3);
+    if (matches.empty()) return;
+    cout << tr(acc.settings, Msg::did_you_mean);
+    for (size_t i = 0; i < matches.size(); ++i) {
+        cout << (i ? ", " : "") << matches[i].number << ". " << matches[i].display;
+    }
+    cout << "\n";
+}
+
+// --bench-categories: build an index over N generated names, then time
+// incremental sync, completions and typo lookups (microseconds per query)
+static int runCategoryIndexBench(int n) {
+    if (n <= 0) { cerr << "bench-categories: N must be > 0\n"; return 1; }
+    static const char *words[] = {"food", "rent", "travel", "savings", "gifts", "health", "car", "kids",
+                                  "utilities", "books", "coffee", "pets", "garden", "tax", "music", "sport"};
+    Account acc;
+    for (int i = 0; i < n; ++i) {
+        string name = string(words[i % 16]) + " " + words[(i / 16) % 16] + " " + to_string(i);
+        acc.ensureCategoryExists(name);
+    }
+    using clk = std::chrono::steady_clock;
+    auto us = [](clk::duration d) { return std::chrono::duration<double, std::micro>(d).count(); };
+
+    auto t0 = clk::now();
+    (void)acc.categories();
+    double buildUs = us(clk::now() - t0);
+
+    t0 = clk::now();
+    acc.ensureCategoryExists("brand new category");
+    (void)acc.categories();
+    double addUs = us(clk::now() - t0);
+
+    const vector<string> queries = {"foo", "travel sp", "sav", "cofee", "utilties 1", "gft", "pets garden 9", "xyzzy"};
+    const int rounds = 200;
+    size_t found = 0;
+    t0 = clk::now();
+    for (int r = 0; r < rounds; ++r)
+        for (auto &q : queries) found += acc.categories().search(q, 10).size();
+    double queryUs = us(clk::now() - t0) / (double)(rounds * queries.size());
+
+    cout << "categories=" << acc.categories().size() << fixed << setprecision(1)
+         << " build=" << buildUs << "us add-one=" << addUs << "us"
+         << " search=" << queryUs << "us/query (" << found / rounds << " matches per round)\n";
+    for (auto &q : queries) {
+        auto m = acc.categories().search(q, 3);
+        cout << "  " << q << " ->";
+        for (auto &x : m) cout << " [" << x.display << "]";
+        cout << "\n";
+    }
+    return 0;
+}
+
 // Interactive allocation percentage setup
 // Allows user to adjust how income is distributed across categories
 // "Other" category gets the remainder (100 - sum of other categories)
@@ -1183,15 +3166,9 @@ void interactiveAllocSetup(Account &acc, bool initialSetup = false) {
         double remaining = 100.0 - sumAssigned;
         if (remaining < 0) remaining = 0.0;
 
-        cout << tr(acc.settings, "alloc_intro") << "\n";
-        cout << tr(acc.settings, "alloc_note") << "\n";
-        {
-            std::ostringstream oss; oss << fixed << setprecision(2) << remaining;
-            std::string s = tr(acc.settings, "alloc_remaining");
-            size_t pos = s.find("{PCT}");
-            if (pos != std::string::npos) s.replace(pos, 5, oss.str());
-            cout << s << "\n";
-        }
+        cout << tr(acc.settings, Msg::alloc_intro) << "\n";
+        cout << tr(acc.settings, Msg::alloc_note) << "\n";
+        cout << formatMsg(acc.settings, Msg::alloc_remaining, MsgArgs().set(Slot::PCT, remaining, 2)) << "\n";
 
         map<string, double> attempted = newPct; // copy to modify inline
         bool anyChange = false;
@@ -1203,30 +3180,24 @@ void interactiveAllocSetup(Account &acc, bool initialSetup = false) {
 
             // per-category input loop to reject negative or >100 values
             while (true) {
-                {
-                    std::ostringstream __oss; __oss << fixed << setprecision(0) << cur;
-                    string s = tr(acc.settings, "alloc_prompt_current_percent");
-                    size_t __pos;
-                    if ((__pos = s.find("{NAME}")) != string::npos) s.replace(__pos, 6, display);
-                    if ((__pos = s.find("{PCT}")) != string::npos) s.replace(__pos, 5, __oss.str());
-                    cout << s;
-                }
+                cout << formatMsg(acc.settings, Msg::alloc_prompt_current_percent,
+                                  MsgArgs().set(Slot::NAME, display).set(Slot::PCT, cur, 0));
                 string line;
-                if (!getline(cin, line)) line.clear();
+                if (!readInputLine(line)) line.clear();
                 trim_inplace(line);
                 if (line.empty()) break; // keep current
                 double val;
                 try {
                     size_t pos = 0;
                     val = stod(line, &pos);
-                    if (pos != line.size()) { cout << tr(acc.settings, "invalid_input_extra") << "\n"; continue; }
+                    if (pos != line.size()) { cout << tr(acc.settings, Msg::invalid_input_extra) << "\n"; continue; }
                 } catch (...) {
-                    cout << tr(acc.settings, "invalid_input") << "\n";
+                    cout << tr(acc.settings, Msg::invalid_input) << "\n";
                     continue;
                 }
-                if (!isfinite(val)) { cout << tr(acc.settings, "invalid_number") << "\n"; continue; }
-                if (val < 0.0) { cout << tr(acc.settings, "invalid_negative_percent") << "\n"; continue; }
-                if (val > 100.0) { cout << tr(acc.settings, "invalid_percent_over") << "\n"; continue; }
+                if (!isfinite(val)) { cout << tr(acc.settings, Msg::invalid_number) << "\n"; continue; }
+                if (val < 0.0) { cout << tr(acc.settings, Msg::invalid_negative_percent) << "\n"; continue; }
+                if (val > 100.0) { cout << tr(acc.settings, Msg::invalid_percent_over) << "\n"; continue; }
                 attempted[k] = val;
                 anyChange = true;
                 break;
@@ -1237,11 +3208,7 @@ void interactiveAllocSetup(Account &acc, bool initialSetup = false) {
         double total = 0.0;
         for (auto &k : keys) total += attempted[k];
         if (total < -1e-9 || total > 100.0 + 1e-9) {
-            std::ostringstream oss; oss << fixed << setprecision(2) << total;
-            std::string s = tr(acc.settings, "invalid_alloc_sum");
-            size_t pos = s.find("{TOTAL}");
-            if (pos != std::string::npos) s.replace(pos, 7, oss.str());
-            cout << s << "\n";
+            cout << formatMsg(acc.settings, Msg::invalid_alloc_sum, MsgArgs().set(Slot::TOTAL, total, 2)) << "\n";
             // loop again
             continue;
         }
@@ -1256,198 +3223,2281 @@ void interactiveAllocSetup(Account &acc, bool initialSetup = false) {
         acc.allocationPct[nkOther] = otherPct;
         // Ensure displayName exists for Other
         if (acc.displayNames.find(nkOther) == acc.displayNames.end()) acc.displayNames[nkOther] = "Other";
-        {
-            std::ostringstream oss; oss << fixed << setprecision(2) << acc.allocationPct[nkOther];
-            std::string s = tr(acc.settings, "allocations_updated");
-            size_t pos = s.find("{PCT}");
-            if (pos != std::string::npos) s.replace(pos, 5, oss.str());
-            cout << s << "\n";
-        }
+        cout << formatMsg(acc.settings, Msg::allocations_updated, MsgArgs().set(Slot::PCT, acc.allocationPct[nkOther], 2)) << "\n";
         break;
     }
 }
 
-// Helper: interactive category creation for initial setup
-void interactiveCategorySetup(Account &acc) {
-    cout << tr(acc.settings, "category_setup_header") << "\n";
-    cout << tr(acc.settings, "category_setup_prompt") << "\n";
-    cout << tr(acc.settings, "category_setup_defaults") << "\n";
-    vector<string> newCats;
-    while (true) {
-        cout << tr(acc.settings, "prompt_category_name");
-        string line;
-        if (!getline(cin, line)) line.clear();
-        trim_inplace(line);
-        if (line.empty()) break;
-        string sanitized = sanitizeDisplayName(line);
-        newCats.push_back(sanitized);
+// Helper: interactive category creation for initial setup
+void interactiveCategorySetup(Account &acc) {
+    cout << tr(acc.settings, Msg::category_setup_header) << "\n";
+    cout << tr(acc.settings, Msg::category_setup_prompt) << "\n";
+    cout << tr(acc.settings, Msg::category_setup_defaults) << "\n";
+    vector<string> newCats;
+    while (true) {
+        cout << tr(acc.settings, Msg::prompt_category_name);
+        string line;
+        if (!readInputLine(line)) line.clear();
+        trim_inplace(line);
+        if (line.empty()) break;
+        string sanitized = sanitizeDisplayName(line);
+        newCats.push_back(sanitized);
+    }
+    if (newCats.empty()) {
+        cout << tr(acc.settings, Msg::no_categories_entered) << "\n";
+        acc = Account(); // defaults already set
+        return;
+    }
+    // Reset account categories to only these plus Other
+    acc.displayNames.clear();
+    acc.categoryIndex.clear();
+    acc.categoryBalances.clear();
+    acc.allocationPct.clear();
+    for (auto &d : newCats) {
+        string nk = normalizeKey(d);
+        acc.displayNames[nk] = d;
+        acc.categoryBalances[nk] = 0.0;
+        acc.allocationPct[nk] = 0.0;
+    }
+    // Ensure Other exists
+    string nkOther = normalizeKey("Other");
+    if (acc.displayNames.find(nkOther) == acc.displayNames.end()) {
+        acc.displayNames[nkOther] = "Other";
+        acc.categoryBalances[nkOther] = 0.0;
+        acc.allocationPct[nkOther] = 0.0;
+    }
+    cout << tr(acc.settings, Msg::categories_created) << "\n";
+}
+
+// Called from main when user chooses to set up new account
+void runInitialSetup(Account &acc) {
+    interactiveCategorySetup(acc);
+    cout << tr(acc.settings, Msg::prompt_setup_alloc);
+    string resp;
+    if (!readInputLine(resp)) resp = "l";
+    trim_inplace(resp);
+    if (!resp.empty() && (resp[0]=='s' || resp[0]=='S')) {
+        interactiveAllocSetup(acc, true);
+    } else {
+        cout << tr(acc.settings, Msg::setup_alloc_later) << "\n";
+    }
+    cout << tr(acc.settings, Msg::setup_complete) << "\n";
+}
+
+// ---- Configuration menus ----
+// Interactive settings menu for user preferences
+// Allows toggling: auto-save, auto-process on startup
+// Allows setting: language (EN, VI, DE)
+// Reset the account and delete the save file and its checkpoint (settings "n").
+// The caller stops the background saver first so no save recreates the file.
+static void nukeAccount(Account &acc) {
+    const std::string saveFile = defaultSavePath();
+    SaveFileLock fileLock(saveFile);
+    acc = Account();
+
+    // try to remove save file
+    remove(checkpointPath(saveFile).c_str());
+    if (remove(saveFile.c_str()) == 0) {
+        cout << tr(acc.settings, Msg::save_file_removed) << "\n";
+    } else {
+        // reuse translation helper for message
+        cout << tr(acc.settings, Msg::no_save_file) << "\n";
+    }
+
+    cout << tr(acc.settings, Msg::nuke_done) << "\n";
+    cout << tr(acc.settings, Msg::exiting_program) << "\n";
+    cout.flush(); // ensure messages are printed
+}
+
+// Returns true when the user confirmed the nuke; the caller then stops saving,
+// calls nukeAccount and exits.
+bool settingsMenu(Account &acc) {
+    // Text-based settings UI; blank input returns to main menu.
+    // Ensure input buffer is clean at entry (we use getline consistently).
+    while (true) {
+        clearScreenAndScrollbackWindows();
+        cout << "\n--- Settings ---\n";
+        // Display exactly as requested with numbered toggles and language block
+        // 1. Auto-save: OFF
+        // 2. Auto process schedules & interest at startup: OFF
+        // 3. Language: EN
+        //     Available languages:
+        //     - EN
+        //     - VI
+        // (n) Nuke program (reset and delete save file)
+        // Press Enter to go back to main menu.
+            cout << tr(acc.settings, Msg::label_auto_save) << tr(acc.settings, acc.settings.autoSave ? Msg::on : Msg::off) << "\n";
+            cout << tr(acc.settings, Msg::label_auto_process) << tr(acc.settings, acc.settings.autoProcessOnStartup ? Msg::on : Msg::off) << "\n";
+            cout << tr(acc.settings, Msg::label_language) << acc.settings.language << "\n";
+            cout << "\t" << tr(acc.settings, Msg::available_languages) << "\n";
+            {
+                auto langs = i18n.availableLanguages();
+                sort(langs.begin(), langs.end(), [](auto &a, auto &b){ return a.second < b.second; });
+                string cur = acc.settings.language;
+                for (size_t i = 0; i < langs.size(); ++i) {
+                    if (langs[i].first == cur) { auto m = langs[i]; langs.erase(langs.begin() + i); langs.insert(langs.begin(), m); break; }
+                }
+                for (auto &p : langs) {
+                    string marker = (p.first == cur) ? " " + string(tr(acc.settings, Msg::current_marker)) : string();
+                    cout << "\t- " << p.first << " - " << p.second << marker << "\n";
+                }
+            }
+            cout << tr(acc.settings, Msg::nuke_desc) << "\n";
+            cout << tr(acc.settings, Msg::press_enter) << "\n";
+            cout << tr(acc.settings, Msg::choice);
+
+        string ch;
+        if (!readInputLine(ch)) ch.clear();
+        trim_inplace(ch);
+        if (ch.empty()) return false; // single Enter returns immediately
+        // Allow user to input number or letter
+        if (ch == "1") {
+            acc.settings.autoSave = !acc.settings.autoSave;
+            cout << tr(acc.settings, Msg::auto_save_changed) << tr(acc.settings, acc.settings.autoSave ? Msg::on : Msg::off) << ".\n";
+        } else if (ch == "2") {
+            acc.settings.autoProcessOnStartup = !acc.settings.autoProcessOnStartup;
+            cout << tr(acc.settings, Msg::auto_process_changed) << tr(acc.settings, acc.settings.autoProcessOnStartup ? Msg::on : Msg::off) << ".\n";
+        } else if (ch == "3") {
+            // Show available languages and allow picking by number or code
+            auto langs = i18n.availableLanguages();
+            cout << "Available languages:\n";
+            for (size_t i = 0; i < langs.size(); ++i) {
+                cout << "\t" << (i+1) << ") " << langs[i].first << " - " << langs[i].second << "\n";
+            }
+            cout << tr(acc.settings, Msg::choose_language_prompt) << " ";
+            string langsel;
+            if (!readInputLine(langsel)) langsel.clear();
+            trim_inplace(langsel);
+            if (!langsel.empty()) {
+                bool changed = false;
+                // number
+                bool isnum = true;
+                for (char ch2 : langsel) if (!isdigit((unsigned char)ch2)) { isnum = false; break; }
+                if (isnum) {
+                    int idx = stoi(langsel) - 1;
+                    if (idx >= 0 && idx < (int)langs.size()) {
+                        acc.settings.language = langs[idx].first;
+                        changed = true;
+                    }
+                } else {
+                    // uppercase code
+                    string code = langsel;
+                    for (auto &c : code) c = (char)toupper((unsigned char)c);
+                    for (auto &p : langs) {
+                        if (p.first == code) { acc.settings.language = code; changed = true; break; }
+                    }
+                }
+                if (changed) {
+                    cout << formatMsg(acc.settings, Msg::language_set, MsgArgs().set(Slot::LANG, acc.settings.language)) << "\n";
+                } else {
+                    cout << tr(acc.settings, Msg::invalid_choice) << "\n";
+                }
+            }
+        } else {
+            // handle n/N for nuke
+            char c = ch[0];
+            if (c == 'n' || c == 'N') {
+                cout << tr(acc.settings, Msg::nuke_confirm);
+                string resp;
+                if (!readInputLine(resp)) resp.clear();
+                trim_inplace(resp);
+                if (!resp.empty() && (resp[0]=='y' || resp[0]=='Y')) {
+                    return true;
+                } else {
+                    cout << tr(acc.settings, Msg::nuke_cancel) << "\n";
+                }
+            } else {
+                cout << tr(acc.settings, Msg::unknown_option) << "\n";
+            }
+        }
+    }
+}
+
+
+// ============================================================
+// SECTION 6B: NON-INTERACTIVE BATCH MODE
+// ============================================================
+// `--batch FILE` runs a compact command language against one in-memory
+// Account and saves once at the end (no menus, no per-action autosave).
+// Use `-` as FILE to read commands from stdin.
+//
+//   add DATE AMOUNT CATEGORY [NOTE...]       CATEGORY "auto" = auto-allocate income
+//   schedule every|monthly PARAM AMOUNT START CATEGORY [NOTE...]
+//   alloc NAME=PCT [NAME=PCT ...]            'Other' receives the remainder
+//   process [DATE]
+//   interest set CATEGORY RATE monthly|annual [START]
+//   interest apply [DATE]
+//   save [FILE]                              choose save target (written once at end)
+//   report
+//
+// DATE is YYYY-MM-DD or "today". Tokens may be double-quoted to include spaces.
+// Blank lines and lines starting with '#' are ignored.
+
+// Split a command line on whitespace; "double quoted" tokens keep their spaces
+static inline vector<string> splitCommandTokens(const string &line) {
+    vector<string> out;
+    size_t i = 0, n = line.size();
+    while (i < n) {
+        while (i < n && isspace((unsigned char)line[i])) ++i;
+        if (i >= n) break;
+        string tok;
+        if (line[i] == '"') {
+            ++i;
+            while (i < n && line[i] != '"') {
+                if (line[i] == '\\' && i + 1 < n) ++i;
+                tok.push_back(line[i++]);
+            }
+            if (i < n) ++i; // closing quote
+        } else {
+            while (i < n && !isspace((unsigned char)line[i])) tok.push_back(line[i++]);
+        }
+        out.push_back(std::move(tok));
+    }
+    return out;
+}
+
+// ---- Engine operations shared by the non-interactive front ends ----
+// Each validates its arguments, applies the change to the Account and returns
+// false with a short English message in err when the request is rejected.
+
+// Add a transaction; category "auto" (or empty for income) auto-allocates
+static bool engineAddTransaction(Account &acc, const chrono_tp &d, double amt, const string &category, const string &note, string &err) {
+    if (!isfinite(amt)) { err = "invalid amount"; return false; }
+    if (category == "auto") {
+        if (amt <= 0.0) { err = "auto-allocate only applies to positive amounts"; return false; }
+        acc.allocateAmount(d, amt, note + " (manual income)");
+    } else {
+        acc.addManualTransaction(d, amt, category, note);
+    }
+    return true;
+}
+
+// Add a recurring schedule; category "auto" auto-allocates positive amounts
+static bool engineAddSchedule(Account &acc, ScheduleType type, int param, double amount, const chrono_tp &start,
+                              const string &category, const string &note, string &err) {
+    if (type == ScheduleType::EveryXDays && param <= 0) { err = "interval must be > 0"; return false; }
+    if (type == ScheduleType::MonthlyDay && (param < 1 || param > 31)) { err = "day of month must be 1-31"; return false; }
+    if (!isfinite(amount)) { err = "invalid amount"; return false; }
+    Schedule s;
+    s.type = type;
+    s.param = param;
+    s.amount = amount;
+    s.nextDate = start;
+    s.note = note;
+    s.autoAllocate = (category == "auto");
+    if (s.autoAllocate && s.amount < 0.0) { s.autoAllocate = false; s.category = "Other"; }
+    else if (!s.autoAllocate) {
+        acc.ensureCategoryExists(category);
+        s.category = acc.displayNames[normalizeKey(sanitizeDisplayName(category))];
+    }
+    acc.addSchedule(s);
+    return true;
+}
+
+// Set allocation percentages for the named categories; 'Other' receives the remainder.
+// Everything is validated first so a bad entry leaves allocations untouched.
+static bool engineSetAllocations(Account &acc, const vector<pair<string,double>> &entries, string &err) {
+    const string nkOther = normalizeKey("Other");
+    map<string, double> attempted = acc.allocationPct;
+    for (auto &e : entries) {
+        if (!isfinite(e.second) || e.second < 0.0 || e.second > 100.0) { err = "percent must be between 0 and 100"; return false; }
+        string nk = normalizeKey(sanitizeDisplayName(e.first));
+        if (nk == nkOther) { err = "'Other' always receives the remainder"; return false; }
+        attempted[nk] = e.second;
+    }
+    double total = 0.0;
+    for (auto &p : attempted) if (p.first != nkOther) total += p.second;
+    if (total > 100.0 + 1e-9) {
+        std::ostringstream oss; oss << fixed << setprecision(2) << total;
+        err = "categories sum to " + oss.str() + "%";
+        return false;
+    }
+    for (auto &e : entries) acc.ensureCategoryExists(e.first);
+    attempted[nkOther] = 100.0 - total;
+    acc.allocationPct = attempted;
+    acc.ensureCategoryExists("Other");
+    return true;
+}
+
+// Set or overwrite the interest rule for one category (created if missing)
+static bool engineSetInterest(Account &acc, const string &category, double ratePct, bool monthly, const chrono_tp &start, string &err) {
+    if (!isfinite(ratePct)) { err = "invalid rate"; return false; }
+    acc.ensureCategoryExists(category);
+    InterestEntry ie;
+    ie.categoryNormalized = normalizeKey(sanitizeDisplayName(category));
+    ie.ratePct = ratePct;
+    ie.monthly = monthly;
+    ie.startDate = start;
+    ie.lastAppliedDate = start; // no prior application
+    acc.interestMap[ie.categoryNormalized] = ie;
+    return true;
+}
+
+// State shared by all commands of one batch run
+struct BatchContext {
+    Account &acc;
+    chrono_tp todayDate;
+    string saveTarget;
+    bool mutated = false;
+    explicit BatchContext(Account &a) : acc(a), todayDate(today()), saveTarget(defaultSavePath()) {}
+};
+
+// Parse a batch DATE argument ("today" or YYYY-MM-DD)
+static inline bool parseBatchDate(const BatchContext &ctx, const string &s, chrono_tp &out) {
+    if (s == "today") { out = ctx.todayDate; return true; }
+    return tryParseDate(s, out);
+}
+
+// Parse a full numeric token (rejects trailing characters)
+static inline bool parseBatchNumber(const string &s, double &out) {
+    try {
+        size_t pos = 0;
+        out = stod(s, &pos);
+        return pos == s.size() && isfinite(out);
+    } catch (...) {
+        return false;
+    }
+}
+
+// Join tokens [from, end) with single spaces (used for trailing notes)
+static inline string joinTokens(const vector<string> &toks, size_t from) {
+    string out;
+    for (size_t i = from; i < toks.size(); ++i) {
+        if (i > from) out.push_back(' ');
+        out += toks[i];
+    }
+    return out;
+}
+
+// Parse quick-entry tokens "DATE AMOUNT CATEGORY [NOTE...]" starting at t[from]
+// DATE may be "today"; the note is the remaining tokens joined by single spaces.
+static bool parseQuickEntryTokens(const vector<string> &t, size_t from, const chrono_tp &todayDate, QuickEntry &out, string &err) {
+    if (t.size() < from + 3) { err = "expected DATE AMOUNT CATEGORY [NOTE...]"; return false; }
+    if (t[from] == "today") out.date = todayDate;
+    else if (!tryParseDate(t[from], out.date)) { err = "invalid date '" + t[from] + "'"; return false; }
+    if (!parseBatchNumber(t[from + 1], out.amount)) { err = "invalid amount '" + t[from + 1] + "'"; return false; }
+    out.category = t[from + 2];
+    if (out.category == "auto" && out.amount <= 0.0) { err = "auto-allocate only applies to positive amounts"; return false; }
+    out.note = joinTokens(t, from + 3);
+    return true;
+}
+
+// Parse one quick-entry line, e.g. `2026-10-01 -12.50 Food lunch` or `today 500 auto "side job"`
+static inline bool parseQuickEntryLine(const string &line, const chrono_tp &todayDate, QuickEntry &out, string &err) {
+    return parseQuickEntryTokens(splitCommandTokens(line), 0, todayDate, out, err);
+}
+
+// Execute one batch command. Returns false and fills err on failure.
+static bool runBatchCommand(BatchContext &ctx, const vector<string> &t, string &err) {
+    Account &acc = ctx.acc;
+    const string &cmd = t[0];
+    if (cmd == "add") {
+        if (t.size() < 4) { err = "usage: add DATE AMOUNT CATEGORY [NOTE...]"; return false; }
+        QuickEntry e;
+        if (!parseQuickEntryTokens(t, 1, ctx.todayDate, e, err)) return false;
+        if (!engineAddTransaction(acc, e.date, e.amount, e.category, e.note, err)) return false;
+        ctx.mutated = true;
+        return true;
+    }
+    if (cmd == "schedule") {
+        if (t.size() < 6) { err = "usage: schedule every|monthly PARAM AMOUNT START CATEGORY [NOTE...]"; return false; }
+        ScheduleType type;
+        if (t[1] == "every") type = ScheduleType::EveryXDays;
+        else if (t[1] == "monthly") type = ScheduleType::MonthlyDay;
+        else { err = "schedule type must be 'every' or 'monthly'"; return false; }
+        double param, amount;
+        chrono_tp start;
+        if (!parseBatchNumber(t[2], param) || param != floor(param) || fabs(param) > 1e6) { err = "invalid schedule param '" + t[2] + "'"; return false; }
+        if (!parseBatchNumber(t[3], amount)) { err = "invalid amount '" + t[3] + "'"; return false; }
+        if (!parseBatchDate(ctx, t[4], start)) { err = "invalid date '" + t[4] + "'"; return false; }
+        if (!engineAddSchedule(acc, type, (int)param, amount, start, t[5], joinTokens(t, 6), err)) return false;
+        ctx.mutated = true;
+        return true;
+    }
+    if (cmd == "alloc") {
+        if (t.size() < 2) { err = "usage: alloc NAME=PCT [NAME=PCT ...]"; return false; }
+        vector<pair<string,double>> entries;
+        for (size_t i = 1; i < t.size(); ++i) {
+            size_t eq = t[i].rfind('=');
+            double pct;
+            if (eq == string::npos || eq == 0 || !parseBatchNumber(t[i].substr(eq + 1), pct)) { err = "expected NAME=PCT, got '" + t[i] + "'"; return false; }
+            entries.emplace_back(t[i].substr(0, eq), pct);
+        }
+        if (!engineSetAllocations(acc, entries, err)) return false;
+        ctx.mutated = true;
+        return true;
+    }
+    if (cmd == "process") {
+        chrono_tp upTo = ctx.todayDate;
+        if (t.size() >= 2 && !parseBatchDate(ctx, t[1], upTo)) { err = "invalid date '" + t[1] + "'"; return false; }
+        acc.processSchedulesUpTo(upTo);
+        ctx.mutated = true;
+        return true;
+    }
+    if (cmd == "interest") {
+        if (t.size() >= 2 && t[1] == "apply") {
+            chrono_tp upTo = ctx.todayDate;
+            if (t.size() >= 3 && !parseBatchDate(ctx, t[2], upTo)) { err = "invalid date '" + t[2] + "'"; return false; }
+            acc.applyInterestUpTo(upTo);
+            ctx.mutated = true;
+            return true;
+        }
+        if (t.size() >= 5 && t[1] == "set") {
+            double ratePct;
+            if (!tryParseRate(t[3], ratePct)) { err = "invalid rate '" + t[3] + "'"; return false; }
+            bool monthly;
+            if (t[4] == "monthly" || t[4] == "m") monthly = true;
+            else if (t[4] == "annual" || t[4] == "a") monthly = false;
+            else { err = "frequency must be 'monthly' or 'annual'"; return false; }
+            chrono_tp start = ctx.todayDate;
+            if (t.size() >= 6 && !parseBatchDate(ctx, t[5], start)) { err = "invalid date '" + t[5] + "'"; return false; }
+            if (!engineSetInterest(acc, t[2], ratePct, monthly, start, err)) return false;
+            ctx.mutated = true;
+            return true;
+        }
+        err = "usage: interest set CATEGORY RATE monthly|annual [START] | interest apply [DATE]";
+        return false;
+    }
+    if (cmd == "save") {
+        if (t.size() >= 2) ctx.saveTarget = t[1];
+        ctx.mutated = true; // an explicit save always writes at the end
+        return true;
+    }
+    if (cmd == "report") {
+        acc.printSummary();
+        return true;
+    }
+    err = "unknown command '" + cmd + "'";
+    return false;
+}
+
+// Run a batch file against the saved account. Returns the process exit code.
+static int runBatchFile(const string &path) {
+    ifstream file;
+    istream *in = &cin;
+    if (path != "-") {
+        file.open(path);
+        if (!file) { cerr << "batch: cannot open " << path << "\n"; return 1; }
+        in = &file;
+    }
+
+    Account acc;
+    (void)acc.loadFromFile(); // start from defaults when no save exists yet
+    BatchContext ctx(acc);
+
+    auto started = chrono::steady_clock::now();
+    size_t lineNo = 0, commands = 0, errors = 0;
+    string line, err;
+    while (getline(*in, line)) {
+        ++lineNo;
+        auto toks = splitCommandTokens(line);
+        if (toks.empty() || toks[0][0] == '#') continue;
+        ++commands;
+        if (!runBatchCommand(ctx, toks, err)) {
+            ++errors;
+            cerr << "batch: line " << lineNo << ": " << err << "\n";
+        }
+    }
+    double elapsedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - started).count();
+
+    if (ctx.mutated) acc.saveToFile(ctx.saveTarget);
+    cerr << "batch: " << commands << " commands, " << errors << " errors, "
+         << fixed << setprecision(1) << elapsedMs << " ms";
+    if (elapsedMs > 0.0) cerr << " (" << setprecision(0) << (commands / (elapsedMs / 1000.0)) << " cmd/s)";
+    cerr << "\n";
+    return errors ? 1 : 0;
+}
+
+
+// ============================================================
+// SECTION 6C: JSON-LINES RPC MODE
+// ============================================================
+// `--rpc` reads one JSON request per line on stdin and writes one JSON
+// response per line on stdout. No menus or terminal control sequences are
+// emitted; any stray UI output is redirected to stderr.
+//
+//   request:  {"id": 1, "method": "add", "params": {"date": "2026-10-01", "amount": -12.5, "category": "Food", "note": "lunch"}}
+//   response: {"id": 1, "result": {...}}   or   {"id": 1, "error": {"code": -32602, "message": "..."}}
+//
+// Requests may be pipelined: the reader never waits for the client, responses
+// carry the request id and are flushed whenever the input buffer runs dry.
+// Mutations stay in memory until a "save" request (or shutdown with auto-save on).
+//
+// Methods: add, schedule, alloc, process, interest.set, interest.remove,
+// interest.apply, save, load, balance, summary, categories, schedules,
+// interest, transactions, shutdown.
+
+// Minimal JSON value (enough for request parsing)
+struct JsonValue {
+    enum Kind { Null, Bool, Number, String, Array, Object } kind = Null;
+    bool b = false;
+    double num = 0.0;
+    string str;
+    vector<JsonValue> items;
+    vector<pair<string, JsonValue>> fields;
+
+    const JsonValue *get(const string &key) const {
+        if (kind != Object) return nullptr;
+        for (auto &f : fields) if (f.first == key) return &f.second;
+        return nullptr;
+    }
+};
+
+// Recursive-descent JSON parser; rejects trailing garbage
+class JsonParser {
+public:
+    explicit JsonParser(const string &text) : s(text) {}
+
+    bool parse(JsonValue &out, string &err) {
+        if (!parseValue(out, err, 0)) return false;
+        skipSpace();
+        if (i != s.size()) { err = "unexpected trailing characters"; return false; }
+        return true;
+    }
+
+private:
+    const string &s;
+    size_t i = 0;
+
+    void skipSpace() { while (i < s.size() && isspace((unsigned char)s[i])) ++i; }
+
+    bool literal(const char *word) {
+        size_t n = strlen(word);
+        if (s.compare(i, n, word) != 0) return false;
+        i += n;
+        return true;
+    }
+
+    static void appendUtf8(string &out, unsigned cp) {
+        if (cp < 0x80) out.push_back((char)cp);
+        else if (cp < 0x800) { out.push_back((char)(0xC0 | (cp >> 6))); out.push_back((char)(0x80 | (cp & 0x3F))); }
+        else if (cp < 0x10000) { out.push_back((char)(0xE0 | (cp >> 12))); out.push_back((char)(0x80 | ((cp >> 6) & 0x3F))); out.push_back((char)(0x80 | (cp & 0x3F))); }
+        else { out.push_back((char)(0xF0 | (cp >> 18))); out.push_back((char)(0x80 | ((cp >> 12) & 0x3F))); out.push_back((char)(0x80 | ((cp >> 6) & 0x3F))); out.push_back((char)(0x80 | (cp & 0x3F))); }
+    }
+
+    bool parseHex4(unsigned &cp) {
+        if (i + 4 > s.size()) return false;
+        cp = 0;
+        for (int k = 0; k < 4; ++k) {
+            char c = s[i++];
+            cp <<= 4;
+            if (c >= '0' && c <= '9') cp |= (unsigned)(c - '0');
+            else if (c >= 'a' && c <= 'f') cp |= (unsigned)(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') cp |= (unsigned)(c - 'A' + 10);
+            else return false;
+        }
+        return true;
+    }
+
+    bool parseString(string &out, string &err) {
+        ++i; // opening quote
+        while (i < s.size()) {
+            char c = s[i++];
+            if (c == '"') return true;
+            if (c != '\\') { out.push_back(c); continue; }
+            if (i >= s.size()) break;
+            char e = s[i++];
+            switch (e) {
+                case '"': out.push_back('"'); break;
+                case '\\': out.push_back('\\'); break;
+                case '/': out.push_back('/'); break;
+                case 'b': out.push_back('\b'); break;
+                case 'f': out.push_back('\f'); break;
+                case 'n': out.push_back('\n'); break;
+                case 'r': out.push_back('\r'); break;
+                case 't': out.push_back('\t'); break;
+                case 'u': {
+                    unsigned cp;
+                    if (!parseHex4(cp)) { err = "invalid \\u escape"; return false; }
+                    if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < s.size() && s[i] == '\\' && s[i+1] == 'u') {
+                        i += 2;
+                        unsigned lo;
+                        if (!parseHex4(lo) || lo < 0xDC00 || lo > 0xDFFF) { err = "invalid surrogate pair"; return false; }
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                    }
+                    if (cp >= 0xD800 && cp <= 0xDFFF) cp = 0xFFFD;   // lone surrogate has no UTF-8 form
+                    appendUtf8(out, cp);
+                    break;
+                }
+                default: err = "invalid escape"; return false;
+            }
+        }
+        err = "unterminated string";
+        return false;
+    }
+
+    bool parseValue(JsonValue &v, string &err, int depth) {
+        if (depth > 32) { err = "nesting too deep"; return false; }
+        skipSpace();
+        if (i >= s.size()) { err = "unexpected end of input"; return false; }
+        char c = s[i];
+        if (c == '"') { v.kind = JsonValue::String; return parseString(v.str, err); }
+        if (c == '{') {
+            v.kind = JsonValue::Object;
+            ++i; skipSpace();
+            if (i < s.size() && s[i] == '}') { ++i; return true; }
+            while (true) {
+                skipSpace();
+                if (i >= s.size() || s[i] != '"') { err = "expected object key"; return false; }
+                string key;
+                if (!parseString(key, err)) return false;
+                skipSpace();
+                if (i >= s.size() || s[i] != ':') { err = "expected ':'"; return false; }
+                ++i;
+                JsonValue child;
+                if (!parseValue(child, err, depth + 1)) return false;
+                v.fields.emplace_back(std::move(key), std::move(child));
+                skipSpace();
+                if (i < s.size() && s[i] == ',') { ++i; continue; }
+                if (i < s.size() && s[i] == '}') { ++i; return true; }
+                err = "expected ',' or '}'";
+                return false;
+            }
+        }
+        if (c == '[') {
+            v.kind = JsonValue::Array;
+            ++i; skipSpace();
+            if (i < s.size() && s[i] == ']') { ++i; return true; }
+            while (true) {
+                JsonValue child;
+                if (!parseValue(child, err, depth + 1)) return false;
+                v.items.push_back(std::move(child));
+                skipSpace();
+                if (i < s.size() && s[i] == ',') { ++i; continue; }
+                if (i < s.size() && s[i] == ']') { ++i; return true; }
+                err = "expected ',' or ']'";
+                return false;
+            }
+        }
+        if (literal("true")) { v.kind = JsonValue::Bool; v.b = true; return true; }
+        if (literal("false")) { v.kind = JsonValue::Bool; v.b = false; return true; }
+        if (literal("null")) { v.kind = JsonValue::Null; return true; }
+        // number
+        size_t start = i;
+        if (i < s.size() && s[i] == '-') ++i;
+        while (i < s.size() && (isdigit((unsigned char)s[i]) || s[i] == '.' || s[i] == 'e' || s[i] == 'E' || s[i] == '+' || s[i] == '-')) ++i;
+        if (start == i) { err = "unexpected character"; return false; }
+        try {
+            size_t used = 0;
+            string tok = s.substr(start, i - start);
+            v.num = stod(tok, &used);
+            if (used != tok.size()) { err = "invalid number"; return false; }
+        } catch (...) { err = "invalid number"; return false; }
+        v.kind = JsonValue::Number;
+        return true;
+    }
+};
+
+// ---- JSON output helpers ----
+static inline void jsonAppendString(string &out, const string &s) {
+    out.push_back('"');
+    for (unsigned char c : s) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out += buf;
+                } else out.push_back((char)c);
+        }
+    }
+    out.push_back('"');
+}
+
+static inline void jsonAppendNumber(string &out, double v) {
+    if (!isfinite(v)) { out += "null"; return; }
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.15g", v);
+    out += buf;
+}
+
+// Re-serialize a parsed value (used to echo request ids back)
+static void jsonAppendValue(string &out, const JsonValue &v) {
+    switch (v.kind) {
+        case JsonValue::Null: out += "null"; break;
+        case JsonValue::Bool: out += v.b ? "true" : "false"; break;
+        case JsonValue::Number: jsonAppendNumber(out, v.num); break;
+        case JsonValue::String: jsonAppendString(out, v.str); break;
+        case JsonValue::Array:
+            out.push_back('[');
+            for (size_t k = 0; k < v.items.size(); ++k) { if (k) out.push_back(','); jsonAppendValue(out, v.items[k]); }
+            out.push_back(']');
+            break;
+        case JsonValue::Object:
+            out.push_back('{');
+            for (size_t k = 0; k < v.fields.size(); ++k) {
+                if (k) out.push_back(',');
+                jsonAppendString(out, v.fields[k].first);
+                out.push_back(':');
+                jsonAppendValue(out, v.fields[k].second);
+            }
+            out.push_back('}');
+            break;
+    }
+}
+
+// JSON-RPC style error codes
+enum RpcErrorCode { RpcParseError = -32700, RpcInvalidRequest = -32600, RpcMethodNotFound = -32601, RpcInvalidParams = -32602 };
+
+// Thrown by the param accessors below; turned into an error response
+struct RpcError {
+    int code;
+    string message;
+};
+
+// Typed access to request params with validation
+struct RpcParams {
+    const JsonValue *obj;
+    chrono_tp todayDate;
+
+    const JsonValue *find(const string &key) const { return obj ? obj->get(key) : nullptr; }
+
+    string str(const string &key, const string &def, bool required = false) const {
+        const JsonValue *v = find(key);
+        if (!v || v->kind == JsonValue::Null) {
+            if (required) throw RpcError{RpcInvalidParams, "missing param '" + key + "'"};
+            return def;
+        }
+        if (v->kind != JsonValue::String) throw RpcError{RpcInvalidParams, "param '" + key + "' must be a string"};
+        return v->str;
+    }
+    double num(const string &key, double def, bool required = false) const {
+        const JsonValue *v = find(key);
+        if (!v || v->kind == JsonValue::Null) {
+            if (required) throw RpcError{RpcInvalidParams, "missing param '" + key + "'"};
+            return def;
+        }
+        if (v->kind != JsonValue::Number || !isfinite(v->num)) throw RpcError{RpcInvalidParams, "param '" + key + "' must be a number"};
+        return v->num;
+    }
+    bool flag(const string &key, bool def) const {
+        const JsonValue *v = find(key);
+        if (!v || v->kind == JsonValue::Null) return def;
+        if (v->kind != JsonValue::Bool) throw RpcError{RpcInvalidParams, "param '" + key + "' must be a boolean"};
+        return v->b;
+    }
+    // Dates are "YYYY-MM-DD" or "today"; missing means today
+    chrono_tp date(const string &key, bool required = false) const {
+        string s = str(key, "today", required);
+        chrono_tp d;
+        if (s == "today") return todayDate;
+        if (!tryParseDate(s, d)) throw RpcError{RpcInvalidParams, "param '" + key + "' must be YYYY-MM-DD"};
+        return d;
+    }
+};
+
+// One RPC session: owns the engine state and dispatches requests
+struct RpcSession {
+    Account acc;
+    std::atomic<bool> dirty{false};
+    std::atomic<bool> shutdownRequested{false};
+    // Optional reader/writer lock (daemon mode): queries share it, mutations hold it exclusively
+    std::shared_mutex *lock = nullptr;
+
+    // Methods that never mutate the account and may run concurrently
+    static bool isReadOnlyMethod(const string &m) {
+        return m == "balance" || m == "summary" || m == "categories" || m == "schedules"
+            || m == "interest" || m == "transactions";
+    }
+
+    static void appendTx(string &out, const Transaction &t) {
+        out += "{\"date\":";
+        jsonAppendString(out, toDateString(t.date));
+        out += ",\"amount\":";
+        jsonAppendNumber(out, t.amount);
+        out += ",\"category\":";
+        jsonAppendString(out, t.category);
+        out += ",\"note\":";
+        jsonAppendString(out, t.note);
+        out.push_back('}');
+    }
+
+    string displayFor(const string &nk) {
+        auto it = acc.displayNames.find(nk);
+        return (it == acc.displayNames.end() || it->second.empty()) ? nk : it->second;
+    }
+
+    void appendBalance(string &out) {
+        out += "{\"balance\":";
+        jsonAppendNumber(out, acc.balance);
+        out += ",\"categories\":{";
+        bool first = true;
+        for (auto &p : acc.categoryBalances) {
+            if (!first) out.push_back(',');
+            first = false;
+            jsonAppendString(out, displayFor(p.first));
+            out.push_back(':');
+            jsonAppendNumber(out, p.second);
+        }
+        out += "}}";
+    }
+
+    // Execute one method; appends the JSON result to out or throws RpcError
+    void dispatch(const string &method, const RpcParams &p, string &out) {
+        string err;
+        auto fail = [&]() { throw RpcError{RpcInvalidParams, err}; };
+
+        if (method == "add") {
+            if (!engineAddTransaction(acc, p.date("date"), p.num("amount", 0.0, true), p.str("category", "Other"), p.str("note", ""), err)) fail();
+            dirty = true;
+            appendBalance(out);
+        } else if (method == "schedule") {
+            string type = p.str("type", "", true);
+            ScheduleType st;
+            if (type == "every") st = ScheduleType::EveryXDays;
+            else if (type == "monthly") st = ScheduleType::MonthlyDay;
+            else throw RpcError{RpcInvalidParams, "type must be 'every' or 'monthly'"};
+            double param = p.num("param", 0.0, true);
+            if (param != floor(param) || fabs(param) > 1e6) throw RpcError{RpcInvalidParams, "param must be an integer"};
+            if (!engineAddSchedule(acc, st, (int)param, p.num("amount", 0.0, true), p.date("start"), p.str("category", "auto"), p.str("note", ""), err)) fail();
+            dirty = true;
+            out += "{\"schedules\":" + to_string(acc.schedules.size()) + "}";
+        } else if (method == "alloc") {
+            const JsonValue *a = p.find("allocations");
+            if (!a || a->kind != JsonValue::Object) throw RpcError{RpcInvalidParams, "allocations must be an object of name -> percent"};
+            vector<pair<string,double>> entries;
+            for (auto &f : a->fields) {
+                if (f.second.kind != JsonValue::Number) throw RpcError{RpcInvalidParams, "percent for '" + f.first + "' must be a number"};
+                entries.emplace_back(f.first, f.second.num);
+            }
+            if (!engineSetAllocations(acc, entries, err)) fail();
+            dirty = true;
+            out += "true";
+        } else if (method == "process") {
+            acc.processSchedulesUpTo(p.date("upTo"));
+            dirty = true;
+            appendBalance(out);
+        } else if (method == "interest.set") {
+            double rate = p.num("rate", 0.0, true);
+            if (!engineSetInterest(acc, p.str("category", "", true), rate, p.flag("monthly", true), p.date("start"), err)) fail();
+            dirty = true;
+            out += "true";
+        } else if (method == "interest.remove") {
+            string nk = normalizeKey(sanitizeDisplayName(p.str("category", "", true)));
+            bool removed = acc.interestMap.erase(nk) > 0;
+            if (removed) dirty = true;
+            out += removed ? "true" : "false";
+        } else if (method == "interest.apply") {
+            acc.applyInterestUpTo(p.date("upTo"));
+            dirty = true;
+            appendBalance(out);
+        } else if (method == "save") {
+            string file = p.str("file", defaultSavePath());
+            acc.saveToFile(file);
+            dirty = false;
+            out += "{\"file\":";
+            jsonAppendString(out, file);
+            out.push_back('}');
+        } else if (method == "load") {
+            string file = p.str("file", defaultSavePath());
+            if (!acc.loadFromFile(file)) throw RpcError{RpcInvalidParams, "cannot open " + file};
+            dirty = false;
+            appendBalance(out);
+        } else if (method == "balance") {
+            appendBalance(out);
+        } else if (method == "summary") {
+            out += "{\"balance\":";
+            jsonAppendNumber(out, acc.balance);
+            out += ",\"transactions\":" + to_string(acc.txs.size());
+            out += ",\"categories\":" + to_string(acc.displayNames.size());
+            out += ",\"schedules\":" + to_string(acc.schedules.size());
+            out += ",\"interest\":" + to_string(acc.interestMap.size());
+            out += ",\"language\":";
+            jsonAppendString(out, acc.settings.language);
+            out += ",\"dirty\":";
+            out += dirty ? "true" : "false";
+            out.push_back('}');
+        } else if (method == "categories") {
+            out.push_back('[');
+            bool first = true;
+            for (auto &p2 : acc.displayNames) {
+                if (!first) out.push_back(',');
+                first = false;
+                auto bal = acc.categoryBalances.find(p2.first);
+                auto pct = acc.allocationPct.find(p2.first);
+                out += "{\"name\":";
+                jsonAppendString(out, displayFor(p2.first));
+                out += ",\"balance\":";
+                jsonAppendNumber(out, bal == acc.categoryBalances.end() ? 0.0 : bal->second);
+                out += ",\"allocation\":";
+                jsonAppendNumber(out, pct == acc.allocationPct.end() ? 0.0 : pct->second);
+                out.push_back('}');
+            }
+            out.push_back(']');
+        } else if (method == "schedules") {
+            out.push_back('[');
+            for (size_t k = 0; k < acc.schedules.size(); ++k) {
+                const Schedule &s = acc.schedules[k];
+                if (k) out.push_back(',');
+                out += "{\"index\":" + to_string(k);
+                out += ",\"type\":";
+                out += (s.type == ScheduleType::EveryXDays ? "\"every\"" : "\"monthly\"");
+                out += ",\"param\":" + to_string(s.param);
+                out += ",\"amount\":";
+                jsonAppendNumber(out, s.amount);
+                out += ",\"next\":";
+                jsonAppendString(out, toDateString(s.nextDate));
+                out += ",\"autoAllocate\":";
+                out += s.autoAllocate ? "true" : "false";
+                out += ",\"category\":";
+                jsonAppendString(out, s.category);
+                out += ",\"note\":";
+                jsonAppendString(out, s.note);
+                out.push_back('}');
+            }
+            out.push_back(']');
+        } else if (method == "interest") {
+            out.push_back('[');
+            bool first = true;
+            for (auto &kv : acc.interestMap) {
+                const InterestEntry &ie = kv.second;
+                if (!first) out.push_back(',');
+                first = false;
+                out += "{\"category\":";
+                jsonAppendString(out, displayFor(ie.categoryNormalized));
+                out += ",\"rate\":";
+                jsonAppendNumber(out, ie.ratePct);
+                out += ",\"monthly\":";
+                out += ie.monthly ? "true" : "false";
+                out += ",\"start\":";
+                jsonAppendString(out, toDateString(ie.startDate));
+                out += ",\"lastApplied\":";
+                jsonAppendString(out, toDateString(ie.lastAppliedDate));
+                out.push_back('}');
+            }
+            out.push_back(']');
+        } else if (method == "transactions") {
+            // Newest first; optional category filter, offset and limit
+            double offsetD = p.num("offset", 0.0), limitD = p.num("limit", 50.0);
+            if (offsetD < 0 || limitD < 0) throw RpcError{RpcInvalidParams, "offset and limit must be >= 0"};
+            // num() rejects non-finite values; clamp before casting so huge ones stay defined
+            const double rows = (double)acc.txs.size();
+            size_t offset = (size_t)min(offsetD, rows), limit = (size_t)min(limitD, rows);
+            string filter = p.str("category", "");
+            string nkFilter = filter.empty() ? string() : normalizeKey(sanitizeDisplayName(filter));
+            size_t matched = 0, emitted = 0;
+            string items;
+            for (size_t k = acc.txs.size(); k-- > 0;) {
+                const Transaction &t = acc.txs[k];
+                if (!nkFilter.empty() && normalizeKey(t.category) != nkFilter) continue;
+                if (matched++ < offset || emitted >= limit) continue;
+                if (emitted++) items.push_back(',');
+                appendTx(items, t);
+            }
+            out += "{\"total\":" + to_string(matched) + ",\"items\":[" + items + "]}";
+        } else if (method == "shutdown") {
+            shutdownRequested = true;
+            out += "true";
+        } else {
+            throw RpcError{RpcMethodNotFound, "unknown method '" + method + "'"};
+        }
+    }
+
+    // Handle one request line and return the response line (without newline)
+    string handleLine(const string &line, const chrono_tp &todayDate) {
+        string resp = "{\"id\":";
+        JsonValue req;
+        string err;
+        JsonParser parser(line);
+        if (!parser.parse(req, err)) {
+            resp += "null";
+            appendError(resp, RpcParseError, err);
+            return resp;
+        }
+        const JsonValue *id = req.get("id");
+        if (id) jsonAppendValue(resp, *id);
+        else resp += "null";
+
+        const JsonValue *method = req.get("method");
+        if (req.kind != JsonValue::Object || !method || method->kind != JsonValue::String) {
+            appendError(resp, RpcInvalidRequest, "request must be an object with a string 'method'");
+            return resp;
+        }
+        const JsonValue *params = req.get("params");
+        if (params && params->kind != JsonValue::Object && params->kind != JsonValue::Null) {
+            appendError(resp, RpcInvalidRequest, "'params' must be an object");
+            return resp;
+        }
+        string result;
+        try {
+            RpcParams p{params, todayDate};
+            if (!lock) dispatch(method->str, p, result);
+            else if (isReadOnlyMethod(method->str)) { std::shared_lock<std::shared_mutex> g(*lock); dispatch(method->str, p, result); }
+            else { std::unique_lock<std::shared_mutex> g(*lock); dispatch(method->str, p, result); }
+        } catch (const RpcError &e) {
+            appendError(resp, e.code, e.message);
+            return resp;
+        }
+        resp += ",\"result\":";
+        resp += result;
+        resp.push_back('}');
+        return resp;
+    }
+
+    static void appendError(string &resp, int code, const string &message) {
+        resp += ",\"error\":{\"code\":" + to_string(code) + ",\"message\":";
+        jsonAppendString(resp, message);
+        resp += "}}";
+    }
+};
+
+// Serve JSON-lines requests on stdin/stdout until EOF or "shutdown"
+static int runRpcMode() {
+    // Protocol output goes to the real stdout; everything printed through cout
+    // by the engine (load/save notices, warnings) is redirected to stderr.
+    ios::sync_with_stdio(false);
+    std::ostream proto(cout.rdbuf());
+    cout.rdbuf(cerr.rdbuf());
+
+    RpcSession session;
+    (void)session.acc.loadFromFile(); // start from defaults when no save exists yet
+
+    string line;
+    while (!session.shutdownRequested && getline(cin, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.find_first_not_of(" \t") == string::npos) continue;
+        string resp = session.handleLine(line, today());
+        proto.write(resp.data(), (std::streamsize)resp.size());
+        proto.put('\n');
+        // Pipelining: only flush once every request already received is answered
+        if (session.shutdownRequested || cin.rdbuf()->in_avail() <= 0) proto.flush();
+    }
+    proto.flush();
+
+    if (session.dirty && session.acc.settings.autoSave) session.acc.saveToFile();
+    cout.rdbuf(proto.rdbuf());
+    return 0;
+}
+
+// ============================================================
+// SECTION 6D: LOCAL DAEMON (UNIX DOMAIN SOCKET)
+// ============================================================
+// `--daemon [SOCKET]` loads locales and the save file once, then serves the
+// JSON-lines protocol of `--rpc` to any number of local clients. Each client
+// gets its own thread; read-only queries run concurrently under a shared lock
+// and mutations are serialized under the exclusive lock.
+// `--client [SOCKET]` forwards stdin requests to the daemon and prints replies.
+// `--client-bench CLIENTS REQUESTS [SOCKET]` runs parallel query clients and
+// reports latency percentiles.
+// The default socket is data/finance.sock under the project root.
+
+static inline std::string defaultSocketPath() {
+    return (std::filesystem::path("data") / "finance.sock").string();
+}
+
+#ifndef _WIN32
+
+// Set by the signal handler / shutdown request; the accept loop polls it
+static std::atomic<bool> gDaemonStop{false};
+
+static void daemonSignalHandler(int) {
+    gDaemonStop.store(true);
+}
+
+// Fill a sockaddr_un; fails when the path does not fit sun_path
+static inline bool makeUnixAddress(const string &path, sockaddr_un &addr) {
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) return false;
+    memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+// Connect to a daemon socket; returns -1 on failure
+static int connectUnixSocket(const string &path) {
+    sockaddr_un addr;
+    if (!makeUnixAddress(path, addr)) return -1;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, (sockaddr *)&addr, sizeof(addr)) != 0) { close(fd); return -1; }
+    return fd;
+}
+
+// Write the whole buffer (handles short writes and EINTR)
+static bool sendAll(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = send(fd, data, len, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+// Buffered newline-delimited reader over a socket
+struct SocketLineReader {
+    int fd;
+    string buf;
+    size_t pos = 0;
+
+    explicit SocketLineReader(int f) : fd(f) {}
+
+    // True when a complete line is already buffered (no syscall needed)
+    bool hasBufferedLine() const { return buf.find('\n', pos) != string::npos; }
+
+    bool readLine(string &line) {
+        while (true) {
+            size_t nl = buf.find('\n', pos);
+            if (nl != string::npos) {
+                line.assign(buf, pos, nl - pos);
+                pos = nl + 1;
+                if (pos > 65536) { buf.erase(0, pos); pos = 0; }
+                return true;
+            }
+            char chunk[8192];
+            ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            buf.append(chunk, (size_t)n);
+        }
+    }
+};
+
+// Serve one client connection until it disconnects; the caller closes fd
+static void serveDaemonClient(RpcSession &session, int fd) {
+    SocketLineReader reader(fd);
+    string line, out;
+    while (!gDaemonStop.load() && reader.readLine(line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.find_first_not_of(" \t") == string::npos) continue;
+        out += session.handleLine(line, today());
+        out.push_back('\n');
+        if (session.shutdownRequested.load()) gDaemonStop.store(true);
+        // Pipelined requests already buffered are answered with a single write
+        if (!reader.hasBufferedLine()) {
+            if (!sendAll(fd, out.data(), out.size())) break;
+            out.clear();
+        }
+    }
+    if (!out.empty()) (void)sendAll(fd, out.data(), out.size());
+}
+
+static int runDaemon(const string &socketPath) {
+    sockaddr_un addr;
+    if (!makeUnixAddress(socketPath, addr)) { cerr << "daemon: socket path too long: " << socketPath << "\n"; return 1; }
+
+    // Refuse to steal the socket from a live daemon; clean up a stale one
+    int probeFd = connectUnixSocket(socketPath);
+    if (probeFd >= 0) { close(probeFd); cerr << "daemon: already running on " << socketPath << "\n"; return 1; }
+    std::error_code ec;
+    std::filesystem::remove(socketPath, ec);
+    std::filesystem::path parent = std::filesystem::path(socketPath).parent_path();
+    if (!parent.empty()) std::filesystem::create_directories(parent, ec);
+
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) { perror("daemon: socket"); return 1; }
+    if (bind(listenFd, (sockaddr *)&addr, sizeof(addr)) != 0) { perror("daemon: bind"); close(listenFd); return 1; }
+    chmod(socketPath.c_str(), 0600); // owner only: the socket exposes the save data
+    if (listen(listenFd, 64) != 0) { perror("daemon: listen"); close(listenFd); return 1; }
+
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, daemonSignalHandler);
+    signal(SIGTERM, daemonSignalHandler);
+
+    // Engine UI output (load/save notices) goes to stderr, like --rpc
+    std::streambuf *origCout = cout.rdbuf(cerr.rdbuf());
+    std::shared_mutex accountLock;
+    RpcSession session;
+    session.lock = &accountLock;
+    (void)session.acc.loadFromFile();
+    cerr << "daemon: listening on " << socketPath << "\n";
+
+    // One detached worker per client, live while its fd is in clientFds. The
+    // worker drops the fd and closes it under clientsMutex, so accept() cannot
+    // reuse the number while it is still listed.
+    std::mutex clientsMutex;
+    std::condition_variable clientsDone;
+    std::set<int> clientFds;
+    while (!gDaemonStop.load()) {
+        pollfd pfd{listenFd, POLLIN, 0};
+        int ready = poll(&pfd, 1, 200); // wake periodically to observe stop requests
+        if (ready <= 0) continue;
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) continue;
+        {
+            std::lock_guard<std::mutex> g(clientsMutex);
+            clientFds.insert(fd);
+        }
+        std::thread([&, fd]() {
+            serveDaemonClient(session, fd);
+            std::lock_guard<std::mutex> g(clientsMutex);
+            clientFds.erase(fd);
+            close(fd);
+            clientsDone.notify_all();
+        }).detach();
+    }
+
+    // Wake clients blocked in recv, then wait for in-flight requests to finish
+    close(listenFd);
+    {
+        std::unique_lock<std::mutex> g(clientsMutex);
+        for (int fd : clientFds) shutdown(fd, SHUT_RDWR);
+        clientsDone.wait(g, [&] { return clientFds.empty(); });
+    }
+    std::filesystem::remove(socketPath, ec);
+
+    if (session.dirty.load() && session.acc.settings.autoSave) session.acc.saveToFile();
+    cerr << "daemon: stopped\n";
+    cout.rdbuf(origCout);
+    return 0;
+}
+
+// Forward stdin requests to the daemon and copy responses to stdout
+static int runDaemonClient(const string &socketPath) {
+    int fd = connectUnixSocket(socketPath);
+    if (fd < 0) { cerr << "client: cannot connect to " << socketPath << " (is --daemon running?)\n"; return 1; }
+    signal(SIGPIPE, SIG_IGN);
+    // Requests stream out on a separate thread so they are pipelined
+    std::thread writer([fd]() {
+        string line;
+        while (getline(cin, line)) {
+            line.push_back('\n');
+            if (!sendAll(fd, line.data(), line.size())) break;
+        }
+        shutdown(fd, SHUT_WR);
+    });
+    char chunk[8192];
+    ssize_t n;
+    while ((n = recv(fd, chunk, sizeof(chunk), 0)) > 0 || (n < 0 && errno == EINTR)) {
+        if (n > 0) cout.write(chunk, n);
+    }
+    cout.flush();
+    writer.join();
+    close(fd);
+    return 0;
+}
+
+// Load test: CLIENTS parallel connections, each issuing REQUESTS sequential queries
+static int runDaemonBench(int clients, int requests, const string &socketPath) {
+    if (clients <= 0 || requests <= 0) { cerr << "client-bench: CLIENTS and REQUESTS must be > 0\n"; return 1; }
+    static const char *queries[] = {
+        "{\"id\":0,\"method\":\"summary\"}\n",
+        "{\"id\":0,\"method\":\"balance\"}\n",
+        "{\"id\":0,\"method\":\"transactions\",\"params\":{\"limit\":10}}\n",
+        "{\"id\":0,\"method\":\"categories\"}\n",
+    };
+    vector<vector<double>> latencies((size_t)clients);
+    std::atomic<int> failures{0};
+    signal(SIGPIPE, SIG_IGN);
+
+    auto started = chrono::steady_clock::now();
+    vector<std::thread> threads;
+    for (int c = 0; c < clients; ++c) {
+        threads.emplace_back([&, c]() {
+            int fd = connectUnixSocket(socketPath);
+            if (fd < 0) { failures += requests; return; }
+            SocketLineReader reader(fd);
+            string reply;
+            auto &lat = latencies[(size_t)c];
+            lat.reserve((size_t)requests);
+            for (int r = 0; r < requests; ++r) {
+                const char *q = queries[(size_t)(c + r) % (sizeof(queries) / sizeof(queries[0]))];
+                auto t0 = chrono::steady_clock::now();
+                if (!sendAll(fd, q, strlen(q)) || !reader.readLine(reply)) { failures += requests - r; break; }
+                lat.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count());
+                if (reply.find("\"error\"") != string::npos) ++failures;
+            }
+            close(fd);
+        });
+    }
+    for (auto &t : threads) t.join();
+    double wallS = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+    vector<double> all;
+    for (auto &l : latencies) all.insert(all.end(), l.begin(), l.end());
+    if (all.empty()) { cerr << "client-bench: no successful requests (is --daemon running on " << socketPath << "?)\n"; return 1; }
+    sort(all.begin(), all.end());
+    auto pct = [&](double q) { return all[min(all.size() - 1, (size_t)(q * (double)(all.size() - 1) + 0.5))]; };
+    cout << "clients=" << clients << " requests=" << all.size() << " failures=" << failures.load() << "\n";
+    cout << fixed << setprecision(1)
+         << "latency_us p50=" << pct(0.50) << " p90=" << pct(0.90) << " p99=" << pct(0.99) << " max=" << all.back() << "\n"
+         << "throughput=" << setprecision(0) << (double)all.size() / wallS << " req/s\n";
+    return failures.load() ? 1 : 0;
+}
+
+#else
+
+static int runDaemon(const string &) { cerr << "daemon: UNIX domain sockets are not supported on this platform\n"; return 1; }
+static int runDaemonClient(const string &) { cerr << "client: UNIX domain sockets are not supported on this platform\n"; return 1; }
+static int runDaemonBench(int, int, const string &) { cerr << "client-bench: UNIX domain sockets are not supported on this platform\n"; return 1; }
+
+#endif
+
+// ============================================================
+// SECTION 6E: FULL-SCREEN TUI
+// ============================================================
+// `--tui` opens a full-screen view of the account: the list of views and
+// actions on the left, the selected view (summary or transaction list) on the
+// right, a title bar and a status line. Adding a transaction or a schedule
+// edits one line in the status bar that runs as the matching --batch command
+// (runBatchCommand); processing runs schedules and interest up to today.
+// Drawing goes into a back buffer of cells. present() compares it with what the
+// terminal already shows and emits only the cells that changed: cursor jumps
+// and attribute changes are added only where needed, and short unchanged gaps
+// are simply rewritten. Each frame leaves in a single write. Pending keys are
+// drained before a frame is drawn, so key repeat over a slow link costs one
+// frame rather than one per key. Only the visible transaction rows are
+// formatted, so long histories scroll in constant time.
+// `--bench-tui [TXS]` replays a scripted session off-screen and compares the
+// bytes per frame with full redraws.
+// Cells assume one column per code point (Latin, Vietnamese, German text).
+
+// Attribute bits of a cell
+enum TuiAttr : uint8_t { TuiBold = 1, TuiDim = 2, TuiReverse = 4 };
+
+struct TuiCell {
+    char32_t ch = U' ';
+    uint8_t attr = 0;
+    bool operator==(const TuiCell &o) const { return ch == o.ch && attr == o.attr; }
+    bool operator!=(const TuiCell &o) const { return !(*this == o); }
+};
+
+// Decode one UTF-8 sequence starting at s[i] (advances i); bad bytes become U+FFFD
+static inline char32_t tuiDecodeUtf8(const string &s, size_t &i) {
+    unsigned char c = (unsigned char)s[i++];
+    if (c < 0x80) return c;
+    int extra = (c >= 0xF0 && c < 0xF8) ? 3 : (c >= 0xE0) ? 2 : (c >= 0xC0) ? 1 : -1;
+    if (extra < 0) return 0xFFFD;
+    char32_t cp = c & (0x3F >> extra);
+    for (int k = 0; k < extra; ++k) {
+        if (i >= s.size() || ((unsigned char)s[i] & 0xC0) != 0x80) return 0xFFFD;
+        cp = (cp << 6) | ((unsigned char)s[i++] & 0x3F);
+    }
+    return cp;
+}
+
+// s padded with spaces to cols columns (one per code point); alignRight pads on the left
+static inline string tuiPad(const string &s, size_t cols, bool alignRight = false) {
+    size_t n = 0;
+    for (size_t i = 0; i < s.size(); ) { tuiDecodeUtf8(s, i); ++n; }
+    if (n >= cols) return s;
+    return alignRight ? string(cols - n, ' ') + s : s + string(cols - n, ' ');
+}
+
+static inline void tuiAppendUtf8(string &out, char32_t cp) {
+    if (cp < 0x80) out.push_back((char)cp);
+    else if (cp < 0x800) { out.push_back((char)(0xC0 | (cp >> 6))); out.push_back((char)(0x80 | (cp & 0x3F))); }
+    else if (cp < 0x10000) {
+        out.push_back((char)(0xE0 | (cp >> 12)));
+        out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back((char)(0xF0 | (cp >> 18)));
+        out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+// Double-buffered cell grid with diff-based presentation
+class TuiGrid {
+public:
+    void resize(int w, int h) {
+        width_ = max(w, 1);
+        height_ = max(h, 1);
+        back_.assign((size_t)width_ * height_, TuiCell{});
+        front_ = back_;
+        fullRedraw_ = true;
+    }
+    int width() const { return width_; }
+    int height() const { return height_; }
+
+    // Forget what the terminal shows; the next present() repaints everything
+    void invalidate() { fullRedraw_ = true; }
+
+    // Hint that rows [top, bottom] moved up by n lines (down when n < 0) since the
+    // last frame. present() then shifts them with one scroll-region command and
+    // only repaints the rows scrolled in, instead of rewriting the whole list.
+    void scrollRows(int top, int bottom, int n) {
+        if (top < 0 || bottom >= height_ || top >= bottom || n == 0 || abs(n) > bottom - top) return;
+        scrollTop_ = top; scrollBottom_ = bottom; scrollBy_ = n;
+    }
+
+    void clear() { std::fill(back_.begin(), back_.end(), TuiCell{}); }
+
+    // Paint columns [x0, x1) of row y with spaces in attr
+    void fillRow(int y, int x0, int x1, uint8_t attr) {
+        if (y < 0 || y >= height_) return;
+        for (int x = max(x0, 0); x < min(x1, width_); ++x) back_[(size_t)y * width_ + x] = TuiCell{U' ', attr};
+    }
+
+    // Write UTF-8 text at (x, y), clipped to maxWidth columns and the screen; returns columns used
+    int text(int x, int y, const string &utf8, uint8_t attr = 0, int maxWidth = INT_MAX) {
+        if (y < 0 || y >= height_) return 0;
+        int limit = min(width_, x + min(maxWidth, width_));
+        int col = x;
+        for (size_t i = 0; i < utf8.size() && col < limit; ) {
+            char32_t cp = tuiDecodeUtf8(utf8, i);
+            if (cp < 0x20 || cp == 0x7F) cp = U' ';
+            if (col >= 0) back_[(size_t)y * width_ + col] = TuiCell{cp, attr};
+            ++col;
+        }
+        return col - x;
+    }
+
+    void put(int x, int y, char32_t cp, uint8_t attr = 0) {
+        if (x < 0 || y < 0 || x >= width_ || y >= height_) return;
+        back_[(size_t)y * width_ + x] = TuiCell{cp, attr};
+    }
+
+    // Append the escape sequences that turn the terminal's picture into the back buffer
+    void present(string &out) {
+        int curX = -1, curY = -1;
+        int curAttr = -1; // unknown
+        if (fullRedraw_) {
+            out += "\033[0m\033[2J";
+            curAttr = 0;
+            std::fill(front_.begin(), front_.end(), TuiCell{});
+            fullRedraw_ = false;
+        } else if (scrollBy_ != 0) {
+            // DECSTBM + SU/SD, then reset the region (which homes the cursor)
+            out += "\033[0m\033[" + to_string(scrollTop_ + 1) + ";" + to_string(scrollBottom_ + 1) + "r";
+            out += "\033[" + to_string(abs(scrollBy_)) + (scrollBy_ > 0 ? "S" : "T");
+            out += "\033[r";
+            curAttr = 0;
+            auto rowAt = [&](int y) { return front_.begin() + (ptrdiff_t)y * width_; };
+            if (scrollBy_ > 0) {
+                std::move(rowAt(scrollTop_ + scrollBy_), rowAt(scrollBottom_ + 1), rowAt(scrollTop_));
+                std::fill(rowAt(scrollBottom_ + 1 - scrollBy_), rowAt(scrollBottom_ + 1), TuiCell{});
+            } else {
+                std::move_backward(rowAt(scrollTop_), rowAt(scrollBottom_ + 1 + scrollBy_), rowAt(scrollBottom_ + 1));
+                std::fill(rowAt(scrollTop_), rowAt(scrollTop_ - scrollBy_), TuiCell{});
+            }
+        }
+        scrollBy_ = 0;
+        for (int y = 0; y < height_; ++y) {
+            const size_t row = (size_t)y * width_;
+            for (int x = 0; x < width_; ++x) {
+                const TuiCell &c = back_[row + x];
+                if (c == front_[row + x]) continue;
+                if (curY != y || curX != x) {
+                    // a short unchanged gap in the current attribute is cheaper to rewrite than to jump over
+                    bool bridge = curY == y && curX >= 0 && x > curX && x - curX <= 4;
+                    for (int k = curX; bridge && k < x; ++k) bridge = back_[row + k].attr == curAttr;
+                    if (bridge) {
+                        for (int k = curX; k < x; ++k) tuiAppendUtf8(out, back_[row + k].ch);
+                    } else {
+                        out += "\033[";
+                        out += to_string(y + 1);
+                        out.push_back(';');
+                        out += to_string(x + 1);
+                        out.push_back('H');
+                    }
+                }
+                if (c.attr != curAttr) { appendSgr(out, c.attr); curAttr = c.attr; }
+                tuiAppendUtf8(out, c.ch);
+                front_[row + x] = c;
+                curY = y;
+                curX = x + 1 < width_ ? x + 1 : -1; // after the last column the cursor state is terminal-specific
+            }
+        }
+        if (curAttr > 0) out += "\033[0m";
+    }
+
+private:
+    int width_ = 0, height_ = 0;
+    vector<TuiCell> back_, front_;
+    bool fullRedraw_ = true;
+    int scrollTop_ = 0, scrollBottom_ = 0, scrollBy_ = 0;
+
+    static void appendSgr(string &out, uint8_t attr) {
+        out += "\033[0";
+        if (attr & TuiBold) out += ";1";
+        if (attr & TuiDim) out += ";2";
+        if (attr & TuiReverse) out += ";7";
+        out.push_back('m');
+    }
+};
+
+// Key codes beyond plain bytes
+enum TuiKey { TuiKeyNone = -1, TuiKeyUp = 1000, TuiKeyDown, TuiKeyLeft, TuiKeyRight, TuiKeyPgUp, TuiKeyPgDn, TuiKeyHome, TuiKeyEnd };
+
+// View state and drawing for the TUI; independent of the terminal so it can be benchmarked
+struct TuiApp {
+    Account &acc;
+    int view = 0;              // 0 = summary, 1 = transactions
+    size_t summaryScroll = 0;
+    size_t txCursor = 0;       // selected row, newest transaction = 0
+    size_t txScroll = 0;       // first visible row
+    string status;
+    // line being edited in the status bar: the batch command it completes, its prompt and the text so far
+    string inputCommand;
+    Msg inputPrompt = Msg::tui_add_prompt;
+    string input;
+    bool dirty = false;        // changed since the last save
+    // what the last frame showed, for scroll hints
+    int drawnView = -1;
+    size_t drawnTxScroll = 0;
+    int drawnW = 0, drawnH = 0;
+
+    explicit TuiApp(Account &a) : acc(a) {}
+
+    // Rows available to the content pane (title and status bars excluded, header row on the list)
+    static int contentRows(const TuiGrid &g) { return max(g.height() - 2, 1); }
+
+    // Apply one key; returns false when the user quits
+    bool handleKey(int key, int pageRows) {
+        if (!inputCommand.empty()) { editKey(key); return true; }
+        const size_t page = (size_t)max(pageRows - 1, 1);
+        auto moveBy = [&](size_t &pos, size_t count, long delta) {
+            if (count == 0) { pos = 0; return; }
+            long next = (long)pos + delta;
+            pos = (size_t)max(0L, min(next, (long)count - 1));
+        };
+        switch (key) {
+            case 'q': case 'Q': return false;
+            case '1': view = 0; break;
+            case '2': view = 1; break;
+            case '\t': case TuiKeyLeft: case TuiKeyRight: view = 1 - view; break;
+            case 's': case 'S':
+                acc.saveToFile(defaultSavePath(), false);
+                dirty = false;
+                status = string(tr(acc.settings, Msg::saved_to)) + defaultSavePath();
+                break;
+            case 'a': case 'A': startInput("add", Msg::tui_add_prompt); break;
+            case 'r': case 'R': startInput("schedule", Msg::tui_schedule_prompt); break;
+            case 'p': case 'P': {
+                const size_t before = acc.txs.size();
+                runCommand({"process"});
+                runCommand({"interest", "apply"});
+                status = formatMsg(acc.settings, Msg::tui_processed, MsgArgs().set(Slot::COUNT, to_string(acc.txs.size() - before)));
+                break;
+            }
+            default: {
+                long delta = 0;
+                if (key == TuiKeyUp || key == 'k') delta = -1;
+                else if (key == TuiKeyDown || key == 'j') delta = 1;
+                else if (key == TuiKeyPgUp) delta = -(long)page;
+                else if (key == TuiKeyPgDn || key == ' ') delta = (long)page;
+                else if (key == TuiKeyHome || key == 'g') delta = LONG_MIN / 2;
+                else if (key == TuiKeyEnd || key == 'G') delta = LONG_MAX / 2;
+                if (delta == 0) break;
+                if (view == 1) moveBy(txCursor, acc.txs.size(), delta);
+                else moveBy(summaryScroll, summaryLines().size(), delta);
+            }
+        }
+        return true;
+    }
+
+    void startInput(const char *command, Msg prompt) {
+        inputCommand = command;
+        inputPrompt = prompt;
+        input.clear();
+    }
+
+    // Line editing: Enter runs the command, Esc cancels, Backspace drops one code point
+    void editKey(int key) {
+        if (key == 27) { inputCommand.clear(); return; }
+        if (key == '\n') {
+            vector<string> tokens = splitCommandTokens(inputCommand + " " + input);
+            inputCommand.clear();
+            if (runCommand(tokens)) status = tr(acc.settings, Msg::added);
+            return;
+        }
+        if (key == 127 || key == 8) {
+            while (!input.empty() && ((unsigned char)input.back() & 0xC0) == 0x80) input.pop_back();
+            if (!input.empty()) input.pop_back();
+        } else if (key >= 32 && key < 256) {
+            input.push_back((char)key);
+        }
+    }
+
+    // Run one --batch command against the account; errors go to the status bar
+    bool runCommand(const vector<string> &tokens) {
+        BatchContext ctx(acc);
+        string err;
+        const bool ok = runBatchCommand(ctx, tokens, err);
+        dirty = dirty || ctx.mutated;
+        if (!ok) status = err;
+        return ok;
+    }
+
+    vector<pair<string, uint8_t>> summaryLines() const {
+        const Settings &s = acc.settings;
+        vector<pair<string, uint8_t>> lines;
+        char buf[64];
+        lines.push_back({formatMsg(s, Msg::tui_total_balance, MsgArgs().set(Slot::TOTAL, acc.balance, 2)), TuiBold});
+        lines.push_back({"", 0});
+        lines.push_back({tuiPad(string(tr(s, Msg::tui_col_category)), 22) + tuiPad(string(tr(s, Msg::tui_col_balance)), 14, true)
+                         + " " + tuiPad(string(tr(s, Msg::tui_col_alloc)), 9, true), TuiBold});
+        for (auto &p : acc.categoryBalances) {
+            auto dn = acc.displayNames.find(p.first);
+            string name = (dn == acc.displayNames.end() || dn->second.empty()) ? p.first : dn->second;
+            auto al = acc.allocationPct.find(p.first);
+            snprintf(buf, sizeof buf, "%14.2f %9.2f", p.second, al == acc.allocationPct.end() ? 0.0 : al->second);
+            lines.push_back({tuiPad(name, 22) + buf, 0});
+        }
+        lines.push_back({"", 0});
+        lines.push_back({formatMsg(s, Msg::tui_interest_count, MsgArgs().set(Slot::COUNT, acc.interestMap.size())) + "   " +
+                         formatMsg(s, Msg::tui_schedule_count, MsgArgs().set(Slot::COUNT, acc.schedules.size())) + "   " +
+                         formatMsg(s, Msg::tui_tx_count, MsgArgs().set(Slot::COUNT, acc.txs.size())), TuiDim});
+        return lines;
+    }
+
+    void draw(TuiGrid &g) {
+        LocaleFrame frame;
+        g.clear();
+        const int w = g.width(), h = g.height();
+        // title bar
+        g.fillRow(0, 0, w, TuiReverse);
+        g.text(1, 0, string(tr(acc.settings, Msg::menu_title)), TuiReverse | TuiBold, w - 2);
+        {
+            char buf[64];
+            snprintf(buf, sizeof buf, "%.2f", acc.balance);
+            string right = string(buf) + " ";
+            g.text(max(w - (int)right.size(), 0), 0, right, TuiReverse | TuiBold);
+        }
+
+        // left pane: views and actions (hidden on narrow terminals)
+        int paneX = 0;
+        if (w >= 48) {
+            const int menuW = min(24, w / 4);
+            const pair<string, string> items[] = {
+                {"1", string(tr(acc.settings, Msg::tui_summary))}, {"2", string(tr(acc.settings, Msg::tui_transactions))},
+                {"a", string(tr(acc.settings, Msg::tui_add))}, {"r", string(tr(acc.settings, Msg::tui_schedule))},
+                {"p", string(tr(acc.settings, Msg::tui_process))},
+                {"s", string(tr(acc.settings, Msg::tui_save))}, {"q", string(tr(acc.settings, Msg::tui_quit))}};
+            for (int i = 0; i < (int)(sizeof items / sizeof items[0]); ++i) {
+                uint8_t attr = (i == view) ? TuiReverse : 0;
+                g.fillRow(2 + i, 0, menuW, attr);
+                g.text(1, 2 + i, items[i].first + "  " + items[i].second, attr, menuW - 2);
+            }
+            for (int y = 1; y < h - 1; ++y) g.put(menuW, y, U'│', TuiDim);
+            paneX = menuW + 2;
+        }
+        const int paneW = max(w - paneX - 1, 1);
+        const int rows = contentRows(g);
+
+        string position;
+        if (view == 0) {
+            auto lines = summaryLines();
+            summaryScroll = min(summaryScroll, lines.empty() ? 0 : lines.size() - 1);
+            for (int r = 0; r < rows && summaryScroll + r < lines.size(); ++r) {
+                auto &ln = lines[summaryScroll + r];
+                g.text(paneX, 1 + r, ln.first, ln.second, paneW);
+            }
+        } else {
+            const size_t n = acc.txs.size();
+            const int listRows = max(rows - 1, 1);
+            // column titles at the x positions of the rows below
+            g.text(paneX, 1, string(tr(acc.settings, Msg::tui_col_date)), TuiBold, min(10, paneW));
+            g.text(paneX + 11, 1, tuiPad(string(tr(acc.settings, Msg::tui_col_amount)), 12, true), TuiBold, paneW - 11);
+            g.text(paneX + 25, 1, string(tr(acc.settings, Msg::tui_col_category)), TuiBold, min(14, paneW - 25));
+            g.text(paneX + 41, 1, string(tr(acc.settings, Msg::tui_col_note)), TuiBold, paneW - 41);
+            if (n == 0) txCursor = 0;
+            else txCursor = min(txCursor, n - 1);
+            if (txCursor < txScroll) txScroll = txCursor;
+            if (txCursor >= txScroll + (size_t)listRows) txScroll = txCursor - listRows + 1;
+            if (drawnView == 1 && drawnW == w && drawnH == h && txScroll != drawnTxScroll) {
+                long shift = (long)txScroll - (long)drawnTxScroll;
+                if (labs(shift) < listRows / 2) g.scrollRows(2, 1 + listRows, (int)shift);
+            }
+            drawnTxScroll = txScroll;
+            char buf[48];
+            for (int r = 0; r < listRows && txScroll + r < n; ++r) {
+                size_t row = txScroll + r;
+                const Transaction &t = acc.txs[n - 1 - row]; // newest first
+                uint8_t attr = row == txCursor ? TuiReverse : 0;
+                g.fillRow(2 + r, paneX, paneX + paneW, attr);
+                snprintf(buf, sizeof buf, "%12.2f", t.amount);
+                int x = paneX;
+                x += g.text(x, 2 + r, toDateString(t.date), attr, paneW) + 1;
+                x += g.text(x, 2 + r, buf, attr, paneX + paneW - x) + 2;
+                int catW = min(14, paneX + paneW - x);
+                g.text(x, 2 + r, t.category, attr, catW);
+                x += catW + 2;
+                if (x < paneX + paneW) g.text(x, 2 + r, t.note, attr, paneX + paneW - x);
+            }
+            if (n) position = to_string(txCursor + 1) + "/" + to_string(n);
+        }
+
+        drawnView = view;
+        drawnW = w;
+        drawnH = h;
+
+        // status bar
+        g.fillRow(h - 1, 0, w, TuiReverse);
+        string left = !inputCommand.empty() ? string(tr(acc.settings, inputPrompt)) + input + "_"
+                    : status.empty() ? string(tr(acc.settings, Msg::tui_keys)) : status;
+        g.text(1, h - 1, left, TuiReverse, w - (int)position.size() - 3);
+        if (!position.empty()) g.text(w - (int)position.size() - 1, h - 1, position, TuiReverse);
+    }
+};
+
+// --bench-tui: replay scrolling and view switches off-screen, diff vs full redraw
+static int runTuiBench(int txCount) {
+    if (txCount < 0) { cerr << "bench-tui: TXS must be >= 0\n"; return 1; }
+    Account acc;
+    chrono_tp base = today();
+    for (int i = 0; i < txCount; ++i)
+        acc.addManualTransaction(addDays(base, -(i % 3650)), (i % 2 ? -1.0 : 1.0) * (i % 97) * 1.25,
+                                 i % 3 ? "Food" : "Other", "bench row " + to_string(i));
+    vector<int> script;
+    script.push_back('2');
+    for (int i = 0; i < 120; ++i) script.push_back(TuiKeyDown);
+    for (int i = 0; i < 40; ++i) script.push_back(TuiKeyPgDn);
+    for (int i = 0; i < 60; ++i) script.push_back(TuiKeyUp);
+    script.push_back(TuiKeyEnd);
+    script.push_back('1');
+    script.push_back('2');
+
+    TuiGrid diffGrid, fullGrid;
+    diffGrid.resize(120, 40);
+    fullGrid.resize(120, 40);
+    TuiApp app(acc);
+    string out;
+    app.draw(diffGrid);
+    diffGrid.present(out); // initial paint is a full redraw for both
+    size_t diffBytes = 0, fullBytes = 0;
+    double drawUs = 0;
+    for (int key : script) {
+        app.handleKey(key, TuiApp::contentRows(diffGrid));
+        auto t0 = chrono::steady_clock::now();
+        app.draw(diffGrid);
+        out.clear();
+        diffGrid.present(out);
+        drawUs += chrono::duration<double, std::micro>(chrono::steady_clock::now() - t0).count();
+        diffBytes += out.size();
+
+        app.draw(fullGrid);
+        fullGrid.invalidate();
+        out.clear();
+        fullGrid.present(out);
+        fullBytes += out.size();
+    }
+    const double frames = (double)script.size();
+    cout << "frames=" << script.size() << " grid=120x40 txs=" << txCount << fixed << setprecision(1)
+         << "\ndiff: " << (double)diffBytes / frames << " bytes/frame, draw+present " << drawUs / frames << " us/frame"
+         << "\nfull redraw: " << (double)fullBytes / frames << " bytes/frame\n";
+    return 0;
+}
+
+#ifndef _WIN32
+
+static std::atomic<bool> gTuiResized{false};
+static std::atomic<bool> gTuiQuit{false};
+
+static void tuiSignalHandler(int sig) {
+    if (sig == SIGWINCH) gTuiResized.store(true);
+    else gTuiQuit.store(true);
+}
+
+// Raw-mode terminal on stdin/stdout; restores everything on destruction
+class TuiTerminal {
+public:
+    bool open() {
+        if (!isatty(STDIN_FILENO) || !isatty(STDOUT_FILENO)) return false;
+        if (tcgetattr(STDIN_FILENO, &saved_) != 0) return false;
+        termios raw = saved_;
+        raw.c_lflag &= ~(ICANON | ECHO | IEXTEN);
+        raw.c_iflag &= ~(IXON | ICRNL);
+        raw.c_cc[VMIN] = 0;
+        raw.c_cc[VTIME] = 0;
+        if (tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw) != 0) return false;
+        active_ = true;
+        write("\033[?1049h\033[?25l");
+        return true;
+    }
+
+    ~TuiTerminal() {
+        if (!active_) return;
+        write("\033[0m\033[?25h\033[?1049l");
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &saved_);
+    }
+
+    bool size(int &w, int &h) const {
+        winsize ws{};
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != 0 || ws.ws_col == 0 || ws.ws_row == 0) return false;
+        w = ws.ws_col;
+        h = ws.ws_row;
+        return true;
+    }
+
+    void write(const string &s) const {
+        size_t off = 0;
+        while (off < s.size()) {
+            ssize_t n = ::write(STDOUT_FILENO, s.data() + off, s.size() - off);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return;
+            off += (size_t)n;
+        }
+    }
+
+    // Next key, or TuiKeyNone when nothing arrives within timeoutMs
+    int readKey(int timeoutMs) const {
+        unsigned char c;
+        if (!readByte(c, timeoutMs)) return TuiKeyNone;
+        if (c != 27) return c == '\r' ? '\n' : c;
+        unsigned char b;
+        if (!readByte(b, 25) || (b != '[' && b != 'O')) return 27;
+        string params;
+        while (readByte(c, 25)) {
+            if (c >= 0x40 && c <= 0x7E) {
+                switch (c) {
+                    case 'A': return TuiKeyUp;
+                    case 'B': return TuiKeyDown;
+                    case 'C': return TuiKeyRight;
+                    case 'D': return TuiKeyLeft;
+                    case 'H': return TuiKeyHome;
+                    case 'F': return TuiKeyEnd;
+                    case '~':
+                        if (params == "5") return TuiKeyPgUp;
+                        if (params == "6") return TuiKeyPgDn;
+                        if (params == "1" || params == "7") return TuiKeyHome;
+                        if (params == "4" || params == "8") return TuiKeyEnd;
+                        return TuiKeyNone;
+                    default: return TuiKeyNone;
+                }
+            }
+            params.push_back((char)c);
+        }
+        return 27;
+    }
+
+private:
+    termios saved_{};
+    bool active_ = false;
+
+    static bool readByte(unsigned char &c, int timeoutMs) {
+        pollfd pfd{STDIN_FILENO, POLLIN, 0};
+        int r = poll(&pfd, 1, timeoutMs);
+        if (r <= 0) return false;
+        return ::read(STDIN_FILENO, &c, 1) == 1;
+    }
+};
+
+// --tui: full-screen browser for the saved account
+static int runTui() {
+    Account acc;
+    if (!acc.loadFromFile()) { cerr << "tui: no save file at " << defaultSavePath() << "; run the interactive setup first\n"; return 1; }
+    TuiTerminal term;
+    if (!term.open()) { cerr << "tui: stdin and stdout must be a terminal\n"; return 1; }
+    signal(SIGWINCH, tuiSignalHandler);
+    signal(SIGINT, tuiSignalHandler);
+    signal(SIGTERM, tuiSignalHandler);
+
+    TuiGrid grid;
+    int w = 80, h = 24;
+    term.size(w, h);
+    grid.resize(w, h);
+    TuiApp app(acc);
+    string frame;
+    bool running = true;
+    bool dirty = true;
+    while (running && !gTuiQuit.load()) {
+        if (gTuiResized.exchange(false) && term.size(w, h)) { grid.resize(w, h); dirty = true; }
+        if (dirty) {
+            app.draw(grid);
+            frame.clear();
+            grid.present(frame);
+            if (!frame.empty()) term.write(frame);
+            dirty = false;
+        }
+        int key = term.readKey(200);
+        // drain everything already typed (key repeat, pasted input) before the next frame
+        while (key != TuiKeyNone) {
+            app.status.clear();
+            if (key == 12) grid.invalidate(); // Ctrl-L: repaint
+            if (!app.handleKey(key, TuiApp::contentRows(grid))) { running = false; break; }
+            dirty = true;
+            key = term.readKey(0);
+        }
+    }
+    if (app.dirty && acc.settings.autoSave) acc.saveToFile(defaultSavePath(), false);
+    return 0;
+}
+
+#else
+
+static int runTui() { cerr << "tui: the full-screen view needs a POSIX terminal\n"; return 1; }
+
+#endif
+
+// ---- Startup profile (--startup-profile) ----
+// Time spent in each step main takes before the first menu is drawn, on a
+// monotonic clock starting at static initialization. Marks are no-ops unless
+// the flag was given.
+struct StartupProfile {
+    using clock = chrono::steady_clock;
+    bool enabled = false;
+    clock::time_point start = clock::now(), last = start;
+    vector<pair<string, double>> phases;   // step -> ms
+
+    void mark(const char *step) {
+        if (!enabled) return;
+        const auto now = clock::now();
+        phases.emplace_back(step, chrono::duration<double, milli>(now - last).count());
+        last = now;
+    }
+
+    double totalMs() const { return chrono::duration<double, milli>(last - start).count(); }
+};
+static StartupProfile gStartupProfile;
+
+// Print the steps up to the first menu, then run and time the work that is
+// deferred until first use
+static int reportStartupProfile(Account &acc) {
+    auto &p = gStartupProfile;
+    cout << "\nStartup profile (ms):\n";
+    for (auto &ph : p.phases) cout << "  " << left << setw(24) << ph.first << right << setw(10) << fixed << setprecision(2) << ph.second << "\n";
+    cout << "  " << left << setw(24) << "time to first menu" << right << setw(10) << p.totalMs() << "\n";
+
+    cout << "Deferred until first use:\n";
+    auto timed = [](auto &&fn) {
+        const auto t0 = StartupProfile::clock::now();
+        fn();
+        return chrono::duration<double, milli>(StartupProfile::clock::now() - t0).count();
+    };
+    const double historyMs = timed([&] { acc.ensureHistory(); });
+    cout << "  " << left << setw(24) << "transaction history" << right << setw(10) << historyMs
+         << "  (" << acc.txs.size() << " rows)\n";
+    size_t languages = 0;
+    const double langMs = timed([&] { languages = i18n.availableLanguages().size(); });
+    cout << "  " << left << setw(24) << "language list" << right << setw(10) << langMs
+         << "  (" << languages << " languages)\n";
+    return 0;
+}
+
+// ---- Instrumentation report (--stats) and overhead benchmark (--bench-stats) ----
+// Print gPerf (see FIN_PERF_SCOPE) to stderr, so protocol output on stdout
+// (--rpc) stays clean; registered with atexit by --stats
+static void printPerfStats() {
+#ifdef FINANCE_STATS
+    std::ostringstream os;
+    os << "\n--- stats ---\n" << left << setw(22) << "operation" << right << setw(10) << "calls" << setw(12) << "total ms"
+       << setw(12) << "avg us" << setw(12) << "max us" << setw(12) << "rows" << "\n";
+    for (size_t i = 0; i < (size_t)PerfOp::Count; ++i) {
+        const PerfCounter &c = gPerf[i];
+        const uint64_t calls = c.calls.load(std::memory_order_relaxed), timed = c.timed.load(std::memory_order_relaxed);
+        const double avgNs = timed ? (double)c.totalNs.load(std::memory_order_relaxed) / (double)timed : 0.0;
+        // Sampled operations: calls and total are estimates (each timed call stands for kPerfSampleEvery)
+        const bool sampled = calls != timed;
+        os << left << setw(22) << kPerfOpNames[i] << right << setw(10) << (sampled ? "~" : "") + std::to_string(calls)
+           << fixed << setprecision(3) << setw(12) << avgNs * (double)calls / 1e6 << setw(12) << avgNs / 1e3
+           << setw(12) << (double)c.maxNs.load(std::memory_order_relaxed) / 1e3 << setw(12) << c.rows.load(std::memory_order_relaxed) << "\n";
     }
-    if (newCats.empty()) {
-        cout << tr(acc.settings, "no_categories_entered") << "\n";
-        acc = Account(); // defaults already set
-        return;
-    }
-    // Reset account categories to only these plus Other
-    acc.displayNames.clear();
-    acc.categoryBalances.clear();
-    acc.allocationPct.clear();
-    for (auto &d : newCats) {
-        string nk = normalizeKey(d);
-        acc.displayNames[nk] = d;
-        acc.categoryBalances[nk] = 0.0;
-        acc.allocationPct[nk] = 0.0;
+    std::cerr << os.str();
+#else
+    std::cerr << "stats: this build has no instrumentation (built with NDEBUG or FINANCE_NO_STATS)\n";
+#endif
+}
+
+// Print the allocations counted per phase (see AllocPhase) to stderr, largest
+// byte count first; registered with atexit by --alloc-stats
+static void printAllocStats() {
+#ifdef FINANCE_ALLOC_STATS
+    struct Row { uint64_t allocs = 0, bytes = 0; };
+    // Read every counter before this report allocates anything itself
+    Row outside{gAllocOutside.allocs.load(std::memory_order_relaxed), gAllocOutside.bytes.load(std::memory_order_relaxed)};
+    std::pair<const char *, Row> slots[kAllocSlots];
+    size_t used = 0;
+    for (const AllocCounter &c : gAllocSlots)
+        if (const char *phase = c.phase.load(std::memory_order_relaxed))
+            slots[used++] = {phase, {c.allocs.load(std::memory_order_relaxed), c.bytes.load(std::memory_order_relaxed)}};
+    // Equal names from different literals are one phase
+    map<string, Row> byName;
+    Row total = outside;
+    for (size_t i = 0; i < used; ++i) {
+        Row &r = byName[slots[i].first];
+        r.allocs += slots[i].second.allocs;
+        r.bytes += slots[i].second.bytes;
+        total.allocs += slots[i].second.allocs;
+        total.bytes += slots[i].second.bytes;
     }
-    // Ensure Other exists
-    string nkOther = normalizeKey("Other");
-    if (acc.displayNames.find(nkOther) == acc.displayNames.end()) {
-        acc.displayNames[nkOther] = "Other";
-        acc.categoryBalances[nkOther] = 0.0;
-        acc.allocationPct[nkOther] = 0.0;
+    vector<pair<string, Row>> rows(byName.begin(), byName.end());
+    if (outside.allocs) rows.emplace_back("(no phase)", outside);
+    stable_sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) { return a.second.bytes > b.second.bytes; });
+    rows.emplace_back("total", total);
+
+    std::ostringstream os;
+    os << "\n--- allocations (innermost phase) ---\n" << left << setw(26) << "phase" << right << setw(12) << "allocs"
+       << setw(14) << "bytes" << setw(10) << "avg B" << setw(9) << "bytes %" << "\n";
+    for (const auto &[name, r] : rows) {
+        os << left << setw(26) << name << right << setw(12) << r.allocs << setw(14) << r.bytes << fixed << setprecision(1)
+           << setw(10) << (r.allocs ? (double)r.bytes / (double)r.allocs : 0.0)
+           << setw(9) << (total.bytes ? 100.0 * (double)r.bytes / (double)total.bytes : 0.0) << "\n";
     }
-    cout << tr(acc.settings, "categories_created") << "\n";
+    std::cerr << os.str();
+#else
+    std::cerr << "alloc-stats: this build does not count allocations (rebuild with -DFINANCE_ALLOC_STATS)\n";
+#endif
 }
 
-// Called from main when user chooses to set up new account
-void runInitialSetup(Account &acc) {
-    interactiveCategorySetup(acc);
-    cout << tr(acc.settings, "prompt_setup_alloc");
-    string resp;
-    if (!getline(cin, resp)) resp = "l";
-    trim_inplace(resp);
-    if (!resp.empty() && (resp[0]=='s' || resp[0]=='S')) {
-        interactiveAllocSetup(acc, true);
-    } else {
-        cout << tr(acc.settings, "setup_alloc_later") << "\n";
+// ---- Trace export (--trace FILE) ----
+#ifdef FINANCE_STATS
+static string gTracePath;
+
+// Write the trace rings (see FIN_TRACE_SCOPE) as Chrome trace-event JSON, for
+// chrome://tracing or ui.perfetto.dev; registered with atexit by --trace.
+// Every path out of main joins the threads that record first (background
+// saver, daemon clients), so the rings are quiet by the time this reads them.
+static void writeTraceFile() {
+    gTraceEnabled.store(false, std::memory_order_relaxed);
+    string out = "{\"traceEvents\":[";
+    size_t events = 0;
+    uint64_t dropped = 0;
+    char num[64];
+    std::lock_guard<std::mutex> g(gTraceRingsMutex);
+    for (auto &r : gTraceRings) {
+        if (out.back() != '[') out += ',';
+        out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + to_string(r->tid) + ",\"args\":{\"name\":";
+        jsonAppendString(out, r->threadName);
+        out += "}}";
+        const uint64_t head = r->head.load(std::memory_order_acquire);
+        const uint64_t first = head > kTraceRingSize ? head - kTraceRingSize : 0;
+        dropped += first;
+        for (uint64_t i = first; i < head; ++i) {
+            const TraceEvent &e = r->events[i & (kTraceRingSize - 1)];
+            out += ",{\"name\":";
+            jsonAppendString(out, e.name);
+            snprintf(num, sizeof num, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f", e.startNs / 1e3, e.durNs / 1e3);
+            out += num;
+            out += ",\"pid\":1,\"tid\":" + to_string(r->tid);
+            if (e.detail[0]) {
+                out += ",\"args\":{\"detail\":";
+                jsonAppendString(out, e.detail);
+                out += '}';
+            }
+            out += '}';
+            ++events;
+        }
     }
-    cout << tr(acc.settings, "setup_complete") << "\n";
+    out += "],\"displayTimeUnit\":\"ms\"}\n";
+    ofstream ofs(gTracePath, ios::out | ios::trunc | ios::binary);
+    ofs << out;
+    if (!ofs) { cerr << "trace: cannot write " << gTracePath << "\n"; return; }
+    cerr << "trace: " << events << " events written to " << gTracePath;
+    if (dropped) cerr << " (" << dropped << " older events dropped)";
+    cerr << "\n";
 }
+#endif
 
-// ---- Configuration menus ----
-// Interactive settings menu for user preferences
-// Allows toggling: auto-save, auto-process on startup
-// Allows setting: language (EN, VI, DE)
-void settingsMenu(Account &acc) {
-    // Text-based settings UI; blank input returns to main menu.
-    // Ensure input buffer is clean at entry (we use getline consistently).
-    while (true) {
-        clearScreenAndScrollbackWindows();
-        cout << "\n--- Settings ---\n";
-        // Display exactly as requested with numbered toggles and language block
-        // 1. Auto-save: OFF
-        // 2. Auto process schedules & interest at startup: OFF
-        // 3. Language: EN
-        //     Available languages:
-        //     - EN
-        //     - VI
-        // (n) Nuke program (reset and delete save file)
-        // Press Enter to go back to main menu.
-            cout << tr(acc.settings, "label_auto_save") << (acc.settings.autoSave ? tr(acc.settings, "on") : tr(acc.settings, "off")) << "\n";
-            cout << tr(acc.settings, "label_auto_process") << (acc.settings.autoProcessOnStartup ? tr(acc.settings, "on") : tr(acc.settings, "off")) << "\n";
-            cout << tr(acc.settings, "label_language") << acc.settings.language << "\n";
-            cout << "\t" << tr(acc.settings, "available_languages") << "\n";
-            {
-                auto langs = i18n.availableLanguages();
-                sort(langs.begin(), langs.end(), [](auto &a, auto &b){ return a.second < b.second; });
-                string cur = acc.settings.language;
-                for (size_t i = 0; i < langs.size(); ++i) {
-                    if (langs[i].first == cur) { auto m = langs[i]; langs.erase(langs.begin() + i); langs.insert(langs.begin(), m); break; }
-                }
-                for (auto &p : langs) {
-                    string marker = (p.first == cur) ? string(" ") + tr(acc.settings, "current_marker") : string();
-                    cout << "\t- " << p.first << " - " << p.second << marker << "\n";
-                }
-            }
-            cout << tr(acc.settings, "nuke_desc") << "\n";
-            cout << tr(acc.settings, "press_enter") << "\n";
-            cout << tr(acc.settings, "choice");
+// Turn tracing on for this run; the file is written at exit
+static void startTrace(const string &path) {
+#ifdef FINANCE_STATS
+    std::error_code ec;
+    const auto abs = std::filesystem::absolute(path, ec);   // main changes directory later
+    gTracePath = ec ? path : abs.string();
+    FIN_TRACE_THREAD("main");
+    gTraceEnabled.store(true, std::memory_order_relaxed);
+    atexit(writeTraceFile);
+#else
+    (void)path;
+    std::cerr << "trace: this build has no instrumentation (built with NDEBUG or FINANCE_NO_STATS)\n";
+#endif
+}
 
-        string ch;
-        if (!getline(cin, ch)) ch.clear();
-        trim_inplace(ch);
-        if (ch.empty()) return; // single Enter returns immediately
-        // Allow user to input number or letter
-        if (ch == "1") {
-            acc.settings.autoSave = !acc.settings.autoSave;
-            cout << tr(acc.settings, "auto_save_changed") << (acc.settings.autoSave ? tr(acc.settings, "on") : tr(acc.settings, "off")) << ".\n";
-        } else if (ch == "2") {
-            acc.settings.autoProcessOnStartup = !acc.settings.autoProcessOnStartup;
-            cout << tr(acc.settings, "auto_process_changed") << (acc.settings.autoProcessOnStartup ? tr(acc.settings, "on") : tr(acc.settings, "off")) << ".\n";
-        } else if (ch == "3") {
-            // Show available languages and allow picking by number or code
-            auto langs = i18n.availableLanguages();
-            cout << "Available languages:\n";
-            for (size_t i = 0; i < langs.size(); ++i) {
-                cout << "\t" << (i+1) << ") " << langs[i].first << " - " << langs[i].second << "\n";
-            }
-            cout << tr(acc.settings, "choose_language_prompt") << " ";
-            string langsel;
-            if (!getline(cin, langsel)) langsel.clear();
-            trim_inplace(langsel);
-            if (!langsel.empty()) {
-                bool changed = false;
-                // number
-                bool isnum = true;
-                for (char ch2 : langsel) if (!isdigit((unsigned char)ch2)) { isnum = false; break; }
-                if (isnum) {
-                    int idx = stoi(langsel) - 1;
-                    if (idx >= 0 && idx < (int)langs.size()) {
-                        acc.settings.language = langs[idx].first;
-                        changed = true;
-                    }
-                } else {
-                    // uppercase code
-                    string code = langsel;
-                    for (auto &c : code) c = (char)toupper((unsigned char)c);
-                    for (auto &p : langs) {
-                        if (p.first == code) { acc.settings.language = code; changed = true; break; }
-                    }
-                }
-                if (changed) {
-                    std::string s = tr(acc.settings, "language_set");
-                    size_t pos = s.find("{LANG}");
-                    if (pos != std::string::npos) s.replace(pos, 6, acc.settings.language);
-                    cout << s << "\n";
-                } else {
-                    cout << tr(acc.settings, "invalid_choice") << "\n";
-                }
-            }
-        } else {
-            // handle n/N for nuke
-            char c = ch[0];
-            if (c == 'n' || c == 'N') {
-                cout << tr(acc.settings, "nuke_confirm");
-                string resp;
-                if (!getline(cin, resp)) resp.clear();
-                trim_inplace(resp);
-                if (!resp.empty() && (resp[0]=='y' || resp[0]=='Y')) {
-                    // reset in-memory account
-                    acc = Account();
+// Per-call time of two instrumented hot paths, tr() and allocateAmount, to be
+// compared between a default build and one with -DNDEBUG; instrumented
+// builds also time an empty FIN_PERF_SCOPE
+static int runStatsBench(int calls) {
+    if (calls <= 0) { cerr << "usage: --bench-stats [CALLS]\n"; return 1; }
+    using clk = chrono::steady_clock;
+    auto nsPerCall = [&](clk::time_point t0, int n) { return chrono::duration<double, nano>(clk::now() - t0).count() / n; };
+    Settings settings;
+    LocaleFrame frame;
+    volatile size_t sink = 0;   // keeps the tr() loop from being optimized away
+    tr(settings, Msg::menu_title);   // build the message table first
+    auto t0 = clk::now();
+    for (int i = 0; i < calls; ++i) sink = sink + tr(settings, (Msg)((size_t)i % kMsgCount)).size();
+    const double trNs = nsPerCall(t0, calls);
 
-                    // try to remove save file
-                    const std::string saveFile = defaultSavePath();
-                    if (remove(saveFile.c_str()) == 0) {
-                        cout << tr(acc.settings, "save_file_removed") << "\n";
-                    } else {
-                        // reuse translation helper for message
-                        cout << tr(acc.settings, "no_save_file") << "\n";
-                    }
+    Account acc;
+    const int allocs = max(1, calls / 20);
+    acc.txs.reserve((size_t)allocs * (acc.allocationPct.size() + 1));
+    const chrono_tp d = today();
+    t0 = clk::now();
+    for (int i = 0; i < allocs; ++i) acc.allocateAmount(d, 100.0, "bench");
+    const double allocNs = nsPerCall(t0, allocs);
+
+#ifdef FINANCE_STATS
+    cout << "instrumentation: built in\n";
+    t0 = clk::now();
+    for (int i = 0; i < calls; ++i) { FIN_PERF_SCOPE(Translate); }
+    cout << "empty FIN_PERF_SCOPE: " << fixed << setprecision(1) << nsPerCall(t0, calls) << " ns\n";
+    t0 = clk::now();
+    for (int i = 0; i < calls; ++i) { FIN_PERF_SAMPLED_SCOPE(Translate); }
+    cout << "empty FIN_PERF_SAMPLED_SCOPE: " << nsPerCall(t0, calls) << " ns\n";
+#else
+    cout << "instrumentation: compiled out\n";
+#endif
+    cout << "tr(): " << fixed << setprecision(1) << trNs << " ns/call (" << calls << " calls)\n";
+    cout << "allocateAmount: " << allocNs << " ns/call (" << allocs << " calls, " << acc.allocationPct.size() << " rows each)\n";
+    return 0;
+}
 
-                    // notify user and exit immediately
-                    cout << tr(acc.settings, "nuke_done") << "\n";
-                    cout << tr(acc.settings, "exiting_program") << "\n";
+// ---- Synthetic save files (--gen-save) ----
+// Options are KEY=VALUE pairs after the file name. Output depends only on the
+// options: values come from mt19937_64 mapped by hand (the std distributions
+// differ between standard libraries), and dates count back from end=.
+struct GenSaveOptions {
+    uint64_t rows = 10000;        // transactions
+    int schedules = 5;
+    int categories = 8;
+    int interest = 2;             // interest entries, on the first categories
+    int years = 5;                // span of the transaction history
+    int catchupMonths = 12;       // schedules and interest last ran this long before end
+    int noteLen = 16;             // average note length in bytes
+    double escapePct = 1.0;       // share of note bytes that are '|', '\\' or newline
+    uint64_t seed = 1;
+    chrono_tp end = today();
+};
 
-                    cout.flush(); // ensure messages are printed
-                    exit(0);     // force immediate termination
-                } else {
-                    cout << tr(acc.settings, "nuke_cancel") << "\n";
-                }
-            } else {
-                cout << tr(acc.settings, "unknown_option") << "\n";
-            }
+static bool parseGenSaveOption(const string &arg, GenSaveOptions &o) {
+    const size_t eq = arg.find('=');
+    if (eq == string::npos) return false;
+    const string key = arg.substr(0, eq), val = arg.substr(eq + 1);
+    try {
+        if (key == "rows") o.rows = stoull(val);
+        else if (key == "schedules") o.schedules = stoi(val);
+        else if (key == "categories") o.categories = stoi(val);
+        else if (key == "interest") o.interest = stoi(val);
+        else if (key == "years") o.years = stoi(val);
+        else if (key == "catchup") o.catchupMonths = stoi(val);
+        else if (key == "note") o.noteLen = stoi(val);
+        else if (key == "escapes") o.escapePct = stod(val);
+        else if (key == "seed") o.seed = stoull(val);
+        else if (key == "end") return tryParseDate(val, o.end);
+        else return false;
+    } catch (...) { return false; }
+    return o.schedules >= 0 && o.categories >= 1 && o.interest >= 0 && o.years >= 1 && o.catchupMonths >= 0
+        && o.noteLen >= 0 && o.escapePct >= 0.0 && o.escapePct <= 100.0;
+}
+
+// Write a save file with o.rows chronological transactions over o.years,
+// header balances matching the rows, and schedules/interest o.catchupMonths
+// behind. Rows are generated twice (balances first, then the file) rather
+// than kept, so 10M-row files need no memory. Errors go to stderr.
+static bool writeSyntheticSave(const string &filename, const GenSaveOptions &o) {
+    static const char *const kNames[] = {"Food", "Rent", "Saving", "Emergency", "Entertainment", "Other",
+                                         "Transport", "Health", "Utilities", "Travel", "Education", "Gifts"};
+    static const char *const kWords[] = {"coffee", "market", "rent", "bus", "ticket", "lunch", "gift", "book",
+                                         "phone", "power", "water", "dinner", "fuel", "pharmacy", "cinema", "refund"};
+    const size_t kNameCount = sizeof kNames / sizeof *kNames, kWordCount = sizeof kWords / sizeof *kWords;
+    vector<string> names;
+    for (int i = 0; i < o.categories; ++i)
+        names.push_back((size_t)i < kNameCount ? string(kNames[i]) : "Category " + to_string(i + 1));
+
+    const chrono_tp start = addMonths(o.end, -12 * o.years);
+    const int spanDays = max(1, daysBetween(start, o.end));
+    const chrono_tp lastRun = addMonths(o.end, -o.catchupMonths);
+
+    std::mt19937_64 valueRng, textRng;
+    auto below = [](std::mt19937_64 &rng, uint64_t n) { return n ? rng() % n : 0; };
+    // Amount in cents and category of the next row: mostly small expenses, some income
+    auto nextRow = [&](int64_t &cents, size_t &cat) {
+        cat = (size_t)below(valueRng, names.size());
+        if (below(valueRng, 5) == 0) cents = 50000 + (int64_t)below(valueRng, 250000);
+        else cents = -(100 + (int64_t)below(valueRng, 20000));
+    };
+    const uint64_t escapeEvery = (uint64_t)(o.escapePct * 100.0);   // per 10000 bytes
+    auto nextNote = [&]() {
+        string note;
+        const size_t len = o.noteLen ? (size_t)(o.noteLen / 2 + (int)below(textRng, (uint64_t)o.noteLen + 1)) : 0;
+        while (note.size() < len) {
+            if (!note.empty()) note += ' ';
+            note += kWords[below(textRng, kWordCount)];
         }
+        note.resize(len);
+        for (char &c : note) if (below(textRng, 10000) < escapeEvery) c = "|\\\n"[below(textRng, 3)];
+        return note;
+    };
+
+    AccountSnapshot snap;
+    snap.settings.language = "EN";
+    for (auto &n : names) {
+        const string nk = normalizeKey(n);
+        snap.displayNames[nk] = n;
+        snap.categoryBalances[nk] = 0.0;
+    }
+    // Allocations over the first four categories; weights sum to 100
+    const int allocs = min(o.categories, 4);
+    for (int i = 0; i < allocs; ++i)
+        snap.allocationPct[normalizeKey(names[i])] = i + 1 < allocs ? 100 / allocs : 100 - (allocs - 1) * (100 / allocs);
+    for (int i = 0; i < min(o.interest, o.categories); ++i) {
+        InterestEntry ie;
+        ie.categoryNormalized = normalizeKey(names[i]);
+        ie.ratePct = 0.5 + (double)(i % 8) * 0.5;
+        ie.monthly = i % 3 == 2;
+        ie.startDate = start;
+        ie.lastAppliedDate = lastRun;
+        snap.interestMap[ie.categoryNormalized] = ie;
+    }
+
+    valueRng.seed(o.seed);
+    vector<int64_t> catCents(names.size(), 0);
+    int64_t totalCents = 0;
+    for (uint64_t i = 0; i < o.rows; ++i) {
+        int64_t cents; size_t cat;
+        nextRow(cents, cat);
+        catCents[cat] += cents;
+        totalCents += cents;
+    }
+    for (size_t i = 0; i < names.size(); ++i) snap.categoryBalances[normalizeKey(names[i])] = (double)catCents[i] / 100.0;
+    snap.balance = (double)totalCents / 100.0;
+
+    valueRng.seed(o.seed);
+    textRng.seed(o.seed ^ 0x9e3779b97f4a7c15ull);
+    for (int i = 0; i < o.schedules; ++i) {
+        Schedule sc;
+        const bool income = i % 3 == 0;
+        sc.type = i % 2 ? ScheduleType::EveryXDays : ScheduleType::MonthlyDay;
+        sc.param = sc.type == ScheduleType::EveryXDays ? (int)(7 * (1 + below(textRng, 4))) : (int)(1 + below(textRng, 28));
+        sc.amount = income ? (double)(100000 + below(textRng, 400000)) / 100.0 : -(double)(1000 + below(textRng, 50000)) / 100.0;
+        sc.autoAllocate = income;
+        sc.nextDate = addDays(lastRun, (int)below(textRng, 28));
+        if (sc.type == ScheduleType::MonthlyDay) sc.nextDate = nextMonthlyOn(addDays(lastRun, -1), sc.param);   // on its day, as menu 2 sets it
+        sc.category = income ? string() : names[below(textRng, names.size())];
+        sc.note = income ? "salary " + to_string(i + 1) : nextNote();
+        snap.schedules.push_back(std::move(sc));
+    }
+
+    const string tmpName = filename + ".tmp";
+    ofstream ofs(tmpName, ios::out | ios::trunc | ios::binary);
+    if (!ofs) { cerr << "gen-save: cannot open " << tmpName << "\n"; return false; }
+    writeSaveHeader(ofs, snap);
+    vector<string> savedNames;
+    for (auto &n : names) savedNames.push_back(escapeForSave(n));
+    string date;
+    int dateDay = -1;
+    char amount[32];
+    for (uint64_t i = 0; i < o.rows; ++i) {
+        int64_t cents; size_t cat;
+        nextRow(cents, cat);
+        const int day = (int)(i * (uint64_t)spanDays / o.rows);
+        if (day != dateDay) { date = escapeForSave(toDateString(addDays(start, day))); dateDay = day; }
+        snprintf(amount, sizeof amount, "%.10f", (double)cents / 100.0);   // as writeSaveHeader's stream formats it
+        ofs << date << "|" << amount << "|" << savedNames[cat] << "|" << escapeForSave(nextNote()) << "\n";
     }
+    ofs.close();
+    std::error_code ec;
+    if (!ofs) { cerr << "gen-save: failed writing " << tmpName << "\n"; std::filesystem::remove(tmpName, ec); return false; }
+    std::filesystem::rename(tmpName, filename, ec);
+    if (ec) { cerr << "gen-save: cannot replace " << filename << ": " << ec.message() << "\n"; return false; }
+    std::filesystem::remove(checkpointPath(filename), ec);   // describes the old file
+    return true;
 }
 
+static int runGenSave(const string &filename, const GenSaveOptions &o) {
+    const auto t0 = chrono::steady_clock::now();
+    if (!writeSyntheticSave(filename, o)) return 1;
+    std::error_code ec;
+    const uintmax_t bytes = std::filesystem::file_size(filename, ec);
+    cout << "gen-save: " << o.rows << " rows, " << o.schedules << " schedules, " << o.categories << " categories, "
+         << min(o.interest, o.categories) << " interest entries, " << toDateString(addMonths(o.end, -12 * o.years))
+         << " to " << toDateString(o.end) << ", seed " << o.seed << "\n"
+         << "wrote " << filename << " (" << bytes << " bytes) in " << fixed << setprecision(1)
+         << chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count() << " ms\n";
+    return 0;
+}
 
 // ============================================================
 // SECTION 7: MAIN ENTRY POINT & INTERACTIVE LOOP
@@ -1455,15 +5505,47 @@ void settingsMenu(Account &acc) {
 // Program initialization, menu loop, and command dispatch
 // Handles: working directory setup, user input parsing, feature execution
 
+#ifndef FINANCE_NO_MAIN   // defined by src/bench_account.cpp, which brings its own main
 int main(int argc, char **argv) {
 
+    // --stats / --alloc-stats / --trace FILE before the other arguments: run as
+    // usual, print the counters / write the trace at exit. Registered first, so
+    // they run after the screen is restored.
+    while (argc >= 2) {
+        const std::string flag = argv[1];
+        int consumed = 0;
+        if (flag == "--stats") {
+            atexit(printPerfStats);
+            consumed = 1;
+        } else if (flag == "--alloc-stats") {
+            atexit(printAllocStats);
+            consumed = 1;
+        } else if (flag == "--trace") {
+            if (argc < 3) { std::cerr << "usage: --trace FILE [other arguments]\n"; return 1; }
+            startTrace(argv[2]);
+            consumed = 2;
+        } else break;
+        for (int i = 1; i + consumed <= argc; ++i) argv[i] = argv[i + consumed];
+        argc -= consumed;
+    }
+
+    // --startup-profile: start up as usual, report each step up to the first menu, exit
+    gStartupProfile.enabled = argc == 2 && std::string(argv[1]) == "--startup-profile";
+
     // Enable ANSI escape sequences
     initTerminalANSI();
     initConsoleUTF8();
 
+    // Helper flags (--dump-loc, --batch, ...) run non-interactively; keep their
+    // output on the normal screen instead of the alternate buffer.
+    const bool helperMode = argc >= 2 && std::string(argv[1]).rfind("--", 0) == 0;
+
     // Switch to alternate screen buffer for clean full-screen UI
-    enterAlternateScreen();
-    atexit(exitAlternateScreen);
+    if (!helperMode) {
+        enterAlternateScreen();
+        atexit(exitAlternateScreen);
+    }
+    gStartupProfile.mark("terminal setup");
     
     // Set up project root based on executable location
     std::filesystem::path exePath(argv[0]);
@@ -1472,6 +5554,7 @@ int main(int argc, char **argv) {
     } catch (...) {
         exePath = std::filesystem::absolute(exePath);
     }
+    gStartupProfile.mark("resolve executable");
     std::filesystem::path baseDir = exePath;
     std::error_code ec;
     if (std::filesystem::is_regular_file(baseDir, ec)) {
@@ -1490,14 +5573,39 @@ int main(int argc, char **argv) {
         if (!probe.has_parent_path()) break;
         probe = probe.parent_path();
     }
+    gStartupProfile.mark("find project root");
     // Now change to project root so all relative paths work correctly
     std::filesystem::current_path(projectRoot);
+    gStartupProfile.mark("change directory");
+
+    // Thin daemon clients only forward requests; skip locale and save loading
+    if ((argc == 2 || argc == 3) && std::string(argv[1]) == "--client") {
+        return runDaemonClient(argc == 3 ? argv[2] : defaultSocketPath());
+    }
+    if ((argc == 4 || argc == 5) && std::string(argv[1]) == "--client-bench") {
+        int clients = 0, requests = 0;
+        try { clients = stoi(argv[2]); requests = stoi(argv[3]); } catch (...) {}
+        return runDaemonBench(clients, requests, argc == 5 ? argv[4] : defaultSocketPath());
+    }
     
-    // Reload i18n now that working directory is correct
-    i18n.reload();
-    loadLocalesFromSubfolders("locales");
-    loadLocalesFromSubfolders("config/locales");
+    // Locales are discovered on first use, now that the working directory is
+    // correct (I18n is lazy, so nothing was scanned before this point). Parsed
+    // files are cached by path, size and mtime, so a warm start parses nothing;
+    // with a compiled bundle (--compile-locales) nothing is scanned at all.
+    i18n.cachePath = (projectRoot / "data" / "cache" / "locales.cache").string();
+    i18n.bundlePath = (projectRoot / "config" / "locales.bundle").string();
     
+    // JSON-lines RPC mode: stdout carries protocol responses only
+    if (argc == 2 && std::string(argv[1]) == "--rpc") {
+        i18n.watch();
+        return runRpcMode();
+    }
+    // Local daemon: load once, serve many clients over a UNIX domain socket
+    if ((argc == 2 || argc == 3) && std::string(argv[1]) == "--daemon") {
+        i18n.watch();   // translators' edits show up without restarting the daemon
+        return runDaemon(argc == 3 ? argv[2] : defaultSocketPath());
+    }
+
     std::cout << "Working directory: " << std::filesystem::current_path() << '\n';
 
     // Helper flag handling: run a single diagnostic task and exit.
@@ -1510,6 +5618,21 @@ int main(int argc, char **argv) {
         return 0;
     }
 
+    // Memory used by the flattened locale tables
+    if (argc == 2 && std::string(argv[1]) == "--locale-stats") {
+        return printLocaleStats();
+    }
+
+    // Build step: regenerate config/messages_gen.h from the locale files
+    if ((argc == 2 || argc == 3) && std::string(argv[1]) == "--gen-catalog") {
+        return runGenCatalog(argc == 3 ? argv[2] : "");
+    }
+
+    // Build step: pack every valid locale into config/locales.bundle
+    if ((argc == 2 || argc == 3) && std::string(argv[1]) == "--compile-locales") {
+        return runCompileLocales(argc == 3 ? argv[2] : "");
+    }
+
     // New helper to list loaded and skipped locale files (useful for debugging broken locales)
     if (argc == 2 && std::string(argv[1]) == "--list-locales") {
         auto d = i18n.getLoadDiagnostics();
@@ -1548,9 +5671,183 @@ int main(int argc, char **argv) {
         }
         std::cout << "PASS: recomputed balance used (got " << acc.balance << " from zero-sum txs, ignoring saved BALANCE 123.45)\n";
         std::error_code ec; std::filesystem::remove(tmp, ec);
+        std::filesystem::remove(tmp.string() + ".lock", ec);
+        return 0;
+    }
+
+    // Regression helper: two instances sharing one save file must not lose each other's rows
+    if (argc == 2 && std::string(argv[1]) == "--test-save-merge") {
+        std::filesystem::path tmp = std::filesystem::temp_directory_path() / "finance_save_merge_test.txt";
+        const string path = tmp.string();
+        chrono_tp d = today();
+        Account a, b;
+        a.addManualTransaction(d, 10.0, "Other", "seed");
+        a.saveToFile(path, false);
+        b.loadFromFile(path);
+        a.addManualTransaction(d, 1.0, "Other", "fromA");
+        b.addManualTransaction(d, 2.0, "Saving", "fromB");
+        b.allocationPct[normalizeKey("Saving")] = 30.0;
+        b.saveToFile(path, false);
+        a.saveToFile(path, false);   // must merge b's row and allocation change
+        Account c;
+        c.loadFromFile(path);
+        std::filesystem::remove(path + ".lock");
+        std::filesystem::remove(checkpointPath(path));
+        std::filesystem::remove(path);
+        if (c.txs.size() != 3 || fabs(c.balance - 13.0) > 0.001) {
+            std::cout << "FAIL: expected 3 rows / balance 13.00 after merge, got " << c.txs.size() << " / " << c.balance << "\n";
+            return 1;
+        }
+        if (c.txs[1].note != "fromB" || c.txs[2].note != "fromA") {
+            std::cout << "FAIL: merged rows out of order (" << c.txs[1].note << ", " << c.txs[2].note << ")\n";
+            return 1;
+        }
+        if (fabs(c.allocationPct[normalizeKey("Saving")] - 30.0) > 0.001) {
+            std::cout << "FAIL: allocation saved by the other instance was lost\n";
+            return 1;
+        }
+        // An early row rewritten (same length) plus an append is not an append,
+        // even when the end of the rows we knew is unchanged: reload, do not merge
+        Account e, f;
+        for (int i = 0; i < 200; ++i) e.addManualTransaction(d, 1.0, "Other", "bulk " + to_string(i));
+        e.saveToFile(path, false);
+        f.loadFromFile(path);
+        string text;
+        {
+            ifstream in(path, ios::in | ios::binary);
+            text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        const size_t first = text.find("|bulk 0\n");
+        if (first != string::npos) text.replace(first, 7, "|BULK 0");
+        text += text.substr(text.rfind('\n', text.size() - 2) + 1);   // and one more row
+        {
+            ofstream out(path, ios::out | ios::trunc | ios::binary);
+            out << text;
+        }
+        Account::ExternalChange change;
+        {
+            SaveFileLock fileLock(path);
+            change = f.mergeExternalChangesLocked(path, false);
+        }
+        std::filesystem::remove(path + ".lock");
+        std::filesystem::remove(checkpointPath(path));
+        std::filesystem::remove(path);
+        if (first == string::npos || !change.reloaded || f.txs.size() != 201 || f.txs.front().note != "BULK 0") {
+            std::cout << "FAIL: rewritten rows were merged as an append (" << f.txs.size() << " rows, first note "
+                      << (f.txs.empty() ? string() : f.txs.front().note) << ")\n";
+            return 1;
+        }
+        std::cout << "PASS: appended rows and settings from another instance were merged before saving, rewritten rows reloaded\n";
+        return 0;
+    }
+
+    // Regression helper: a checkpoint start must match a full parse, including rows appended after the checkpoint
+    if (argc == 2 && std::string(argv[1]) == "--test-checkpoint-load") {
+        std::filesystem::path tmp = std::filesystem::temp_directory_path() / "finance_checkpoint_test.txt";
+        const string path = tmp.string();
+        chrono_tp d = today();
+        Account a, b;
+        for (int i = 0; i < 50; ++i) a.addManualTransaction(d, 1.25 + i, i % 2 ? "Saving" : "Food", "row");
+        a.saveToFile(path, false);                    // writes the checkpoint for 50 rows
+        std::filesystem::copy_file(checkpointPath(path), path + ".old", std::filesystem::copy_options::overwrite_existing);
+        b.loadFromFile(path);
+        b.addManualTransaction(d, 2.5, "Food", "after checkpoint");
+        b.saveToFile(path, false);
+        Account full, fast;
+        full.loadFromFile(path);
+        std::filesystem::rename(path + ".old", checkpointPath(path));   // back to the 50-row checkpoint
+        const bool fromCheckpoint = fast.loadFromFile(path, Account::LoadMode::Checkpoint) && fast.deferredHistory && fast.txs.empty();
+        const double fastBalance = fast.balance, fastFood = fast.categoryBalances[normalizeKey("Food")];
+        fast.ensureHistory();
+        // An older row edited to the same length must not pass for the checkpoint's rows
+        string text;
+        {
+            ifstream in(path, ios::in | ios::binary);
+            text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        const size_t edit = text.find("|1.25");
+        if (edit != string::npos) text[edit + 1] = '9';
+        {
+            ofstream out(path, ios::out | ios::trunc | ios::binary);
+            out << text;
+        }
+        Account edited;
+        const bool editedFromCheckpoint = edited.loadFromFile(path, Account::LoadMode::Checkpoint) && edited.deferredHistory;
+        std::filesystem::remove(path + ".lock");
+        std::filesystem::remove(checkpointPath(path));
+        std::filesystem::remove(path);
+        if (!fromCheckpoint) { std::cout << "FAIL: checkpoint was not used\n"; return 1; }
+        if (fabs(fastBalance - full.balance) > 0.001 || fabs(fastFood - full.categoryBalances[normalizeKey("Food")]) > 0.001) {
+            std::cout << "FAIL: checkpoint balance " << fastBalance << " / Food " << fastFood << ", full parse " << full.balance
+                      << " / " << full.categoryBalances[normalizeKey("Food")] << "\n";
+            return 1;
+        }
+        if (fast.txs.size() != full.txs.size() || fast.txs.size() != 51 || fast.txs.back().note != "after checkpoint") {
+            std::cout << "FAIL: expected 51 rows after loading the history, got " << fast.txs.size() << "\n";
+            return 1;
+        }
+        if (edit == string::npos || editedFromCheckpoint || fabs(edited.balance - (full.balance + 8.0)) > 0.001) {
+            std::cout << "FAIL: a row edited after the checkpoint was not picked up (balance " << edited.balance << ")\n";
+            return 1;
+        }
+        std::cout << "PASS: checkpoint plus appended rows matched a full parse (" << fast.txs.size() << " rows)\n";
         return 0;
     }
 
+    // Reproducible synthetic save file for benchmarks (see GenSaveOptions)
+    if (argc >= 3 && std::string(argv[1]) == "--gen-save") {
+        GenSaveOptions opts;
+        for (int i = 3; i < argc; ++i) {
+            if (!parseGenSaveOption(argv[i], opts)) {
+                cerr << "gen-save: bad option '" << argv[i] << "'\n"
+                     << "usage: --gen-save FILE [rows=N] [schedules=N] [categories=N] [interest=N] [years=N] [catchup=MONTHS]"
+                        " [note=LEN] [escapes=PCT] [seed=N] [end=YYYY-MM-DD]\n";
+                return 1;
+            }
+        }
+        return runGenSave(argv[2], opts);
+    }
+
+    // Non-interactive batch mode: run scripted commands, save once at the end
+    if (argc == 3 && std::string(argv[1]) == "--batch") {
+        return runBatchFile(argv[2]);
+    }
+
+    // Prompt latency of synchronous auto-save versus group commit
+    if ((argc >= 2 && argc <= 4) && std::string(argv[1]) == "--bench-autosave") {
+        int actions = 200, txCount = 100000;
+        try {
+            if (argc >= 3) actions = stoi(argv[2]);
+            if (argc >= 4) txCount = stoi(argv[3]);
+        } catch (...) { actions = 0; }
+        return runAutoSaveBench(actions, txCount);
+    }
+
+    // Full-screen browser (alternate screen, raw keys, diff rendering)
+    if (argc == 2 && std::string(argv[1]) == "--tui") {
+        i18n.watch();
+        return runTui();
+    }
+    if ((argc == 2 || argc == 3) && std::string(argv[1]) == "--bench-tui") {
+        int txCount = 100000;
+        try { if (argc == 3) txCount = stoi(argv[2]); } catch (...) { txCount = -1; }
+        return runTuiBench(txCount);
+    }
+
+    // Overhead of the built-in instrumentation (see FIN_PERF_SCOPE)
+    if ((argc == 2 || argc == 3) && std::string(argv[1]) == "--bench-stats") {
+        int calls = 2000000;
+        try { if (argc == 3) calls = stoi(argv[2]); } catch (...) { calls = 0; }
+        return runStatsBench(calls);
+    }
+
+    // Non-interactive helper: category index build/search timings
+    if ((argc == 2 || argc == 3) && std::string(argv[1]) == "--bench-categories") {
+        int n = 5000;
+        try { if (argc == 3) n = stoi(argv[2]); } catch (...) { n = 0; }
+        return runCategoryIndexBench(n);
+    }
+
     // Non-interactive helper to dump the Settings display (useful for automated checks)
     if (argc == 2 && std::string(argv[1]) == "--dump-settings") {
         Account acc;
@@ -1559,7 +5856,7 @@ int main(int argc, char **argv) {
         cout << "1. Auto-save: " << (acc.settings.autoSave ? "ON" : "OFF") << "\n";
         cout << "2. Auto process schedules & interest at startup: " << (acc.settings.autoProcessOnStartup ? "ON" : "OFF") << "\n";
         cout << "3. Language: " << acc.settings.language << "\n";
-        cout << "\t" << tr(acc.settings, "available_languages") << "\n";
+        cout << "\t" << tr(acc.settings, Msg::available_languages) << "\n";
         {
             auto langs = i18n.availableLanguages();
             sort(langs.begin(), langs.end(), [](auto &a, auto &b){ return a.second < b.second; });
@@ -1568,13 +5865,13 @@ int main(int argc, char **argv) {
                 if (langs[i].first == cur) { auto m = langs[i]; langs.erase(langs.begin() + i); langs.insert(langs.begin(), m); break; }
             }
             for (auto &p : langs) {
-                string marker = (p.first == cur) ? string(" ") + tr(acc.settings, "current_marker") : string();
+                string marker = (p.first == cur) ? " " + string(tr(acc.settings, Msg::current_marker)) : string();
                 cout << "\t- " << p.first << " - " << p.second << marker << "\n";
             }
         }
         cout << "(n) Nuke program (reset and delete save file)\n";
-        cout << tr(acc.settings, "press_enter") << "\n";
-        cout << tr(acc.settings, "choice");
+        cout << tr(acc.settings, Msg::press_enter) << "\n";
+        cout << tr(acc.settings, Msg::choice);
         return 0;
     }
 
@@ -1584,47 +5881,83 @@ int main(int argc, char **argv) {
     Account acc;
 
     // Try to load saved state; if missing, run initial setup or retry.
-    // Attempt to load; if missing, ask user whether to set up or retry
-    bool loaded = acc.loadFromFile();
+    // With a current checkpoint only the header is read now: the transactions
+    // are parsed when a menu action first needs them (the summary reads just
+    // the last rows), and only the save file's language is merged until
+    // another one is asked for.
+    bool loaded = acc.loadFromFile(defaultSavePath(), Account::LoadMode::Checkpoint);
+    gStartupProfile.mark("load save");
+    if (loaded) i18n.primaryCodes = {acc.settings.language};
+    i18n.ensureLoaded();
+    gStartupProfile.mark("load locales");
     if (!loaded) {
-        cout << tr(acc.settings, "cannot_open_load") << "\n";
+        cout << tr(acc.settings, Msg::cannot_open_load) << "\n";
         while (true) {
-            cout << tr(acc.settings, "choose_setup_or_retry");
+            cout << tr(acc.settings, Msg::choose_setup_or_retry);
             string resp;
-            if (!getline(cin, resp)) { resp = "s"; }
+            if (!readInputLine(resp)) { resp = "s"; }
             trim_inplace(resp);
             if (!resp.empty() && (resp[0]=='s' || resp[0]=='S')) {
                 runInitialSetup(acc);
                 break;
             } else if (!resp.empty() && (resp[0]=='r' || resp[0]=='R')) {
-                cout << tr(acc.settings, "retrying_load") << "\n";
+                cout << tr(acc.settings, Msg::retrying_load) << "\n";
                 if (acc.loadFromFile()) {
                     break;
                 } else {
-                    cout << tr(acc.settings, "still_no_save") << "\n";
+                    cout << tr(acc.settings, Msg::still_no_save) << "\n";
                     continue;
                 }
             } else {
-                cout << tr(acc.settings, "please_answer_s_or_r") << "\n";
+                cout << tr(acc.settings, Msg::please_answer_s_or_r) << "\n";
             }
         }   
     } else {
         // If loaded and auto-process setting is enabled, run it now
         if (acc.settings.autoProcessOnStartup) {
-            cout << tr(acc.settings, "auto_processing_start") << "\n";
+            cout << tr(acc.settings, Msg::auto_processing_start) << "\n";
+            acc.ensureHistory();
             acc.processSchedulesUpTo(today());
             acc.applyInterestUpTo(today());
-            cout << tr(acc.settings, "auto_processing_done") << "\n";
+            cout << tr(acc.settings, Msg::auto_processing_done) << "\n";
+            gStartupProfile.mark("auto-process");
         }
     }
 
+    // Saves run on a background writer (see BackgroundSaver): auto-save is a
+    // group commit and menu 7 hands over a snapshot; pending changes are
+    // flushed once more when main returns.
+    // accGuard is held while an action runs and released at every read from the
+    // terminal (InputWait), including the prompts inside an action.
+    std::mutex accMutex;
+    BackgroundSaver saver(acc, accMutex, defaultSavePath());
+    i18n.watch();   // edited .lang files apply at the next redraw
+    saver.start();
+    std::unique_lock<std::mutex> accGuard(accMutex);
+    gInputIdleLock = &accGuard;
+    gStartupProfile.mark("start saver and watcher");
+
     // Main menu loop: read a choice, execute action, then prompt to return/save.
     while (true) {
+        LocaleFrame frame;   // one locale snapshot per pass; watched edits apply on the next
+        // Report manual saves that finished in the background
+        for (auto &n : saver.takeNotices()) if (n.ok) cout << tr(acc.settings, Msg::saved_to) << n.file << "\n";
+        {
+            // Pick up what other instances saved meanwhile
+            SaveFileLock fileLock(defaultSavePath());
+            printExternalChange(acc, acc.mergeExternalChangesLocked(defaultSavePath(), false));
+        }
         printMenu(acc.settings);
+        if (gStartupProfile.enabled) {
+            gStartupProfile.mark("first menu");
+            return reportStartupProfile(acc);
+        }
         string choiceStr;
-        if (!getline(cin, choiceStr)) break;
+        saver.setActionRunning(false);
+        if (!readInputLine(choiceStr)) break;
         trim_inplace(choiceStr);
         if (choiceStr.empty()) continue;
+        saver.setActionRunning(true);
 
         bool didExit = false;
 
@@ -1633,16 +5966,18 @@ int main(int argc, char **argv) {
         } else {
             int choice = -1;
             try { choice = stoi(choiceStr); } catch (...) {
-                cout << tr(acc.settings, "invalid_choice") << "\n";
+                cout << tr(acc.settings, Msg::invalid_choice) << "\n";
                 if (!askReturnToMenuOrSave(acc)) break;
                 else continue;
             }
+            // The summary and exit work without the deferred transactions
+            if (choice != 3 && choice != 9) acc.ensureHistory();
 
             if (choice == 1) {
                 // --- Add manual transaction (improved category selection) ---
                 clearScreenAndScrollbackWindows();
                 cout << "[Esc (or type 'esc') then Enter returns to main menu at any prompt]\n";
-                cout << tr(acc.settings, "prompt_date");
+                cout << tr(acc.settings, Msg::prompt_date);
                 string dateStr;
                 chrono_tp d;
                 bool cancelFlow = false;
@@ -1651,11 +5986,11 @@ int main(int argc, char **argv) {
                     trim_inplace(dateStr);
                     if (dateStr.empty()) { d = today(); break; }
                     if (tryParseDate(dateStr, d)) break;
-                    cout << tr(acc.settings, "invalid_date_format") << "\n" << tr(acc.settings, "prompt_date");
+                    cout << tr(acc.settings, Msg::invalid_date_format) << "\n" << tr(acc.settings, Msg::prompt_date);
                 }
                 if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
-                cout << tr(acc.settings, "prompt_amount");
+                cout << tr(acc.settings, Msg::prompt_amount);
                 double amt;
                 string amtLine;
                 while (true) {
@@ -1665,23 +6000,17 @@ int main(int argc, char **argv) {
                         amt = stod(amtLine);
                         break;
                     } catch (...) {
-                        cout << tr(acc.settings, "invalid_amount") << "\n" << tr(acc.settings, "prompt_amount");
+                        cout << tr(acc.settings, Msg::invalid_amount) << "\n" << tr(acc.settings, Msg::prompt_amount);
                     }
                 }
                 if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
-                vector<pair<string,string>> cats; // pair<display, normalized>
-                for (auto &p : acc.displayNames) cats.emplace_back(p.second.empty() ? p.first : p.second, p.first);
-                sort(cats.begin(), cats.end(), [](auto &a, auto &b){ return a.first < b.first; });
-
-                cout << tr(acc.settings, "existing_categories") << "\n";
-                for (size_t i = 0; i < cats.size(); ++i) {
-                    cout << "  " << (i+1) << ". " << cats[i].first << "\n";
-                }
-                cout << tr(acc.settings, "prompt_category") ;
+                // pair<display, normalized>; stays valid until a category is created
+                const auto &cats = acc.categories().sorted();
+                printCategoryList(acc);
+                cout << tr(acc.settings, Msg::prompt_category) ;
                 string catInput;
-                if (!getlineAllowEsc(catInput)) { cout << "Cancelled. Returning to main menu.\n"; continue; }
-                trim_inplace(catInput);
+                if (!readCategoryInput(acc, catInput, Msg::prompt_category)) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
                 bool willAutoAllocate = false;
                 string chosenDisplayCat;
@@ -1699,7 +6028,7 @@ int main(int argc, char **argv) {
                             if (idx >= 1 && idx <= (int)cats.size()) {
                                 chosenDisplayCat = cats[idx-1].first;
                                 handled = true;
-                            } else { cout << tr(acc.settings, "number_out_of_range") << "\n"; }
+                            } else { cout << tr(acc.settings, Msg::number_out_of_range) << "\n"; }
                         } catch (...) {}
                     }
                     if (!handled) {
@@ -1711,10 +6040,8 @@ int main(int argc, char **argv) {
                                 break;
                             }
 
-                            string s = tr(acc.settings, "category_missing_prompt");
-                            size_t pos = s.find("{NAME}");
-                            if (pos != string::npos) s.replace(pos, 6, sanitized);
-                            cout << s;
+                            printCategorySuggestions(acc, catInput);
+                            cout << formatMsg(acc.settings, Msg::category_missing_prompt, MsgArgs().set(Slot::NAME, sanitized));
                             string resp;
                             if (!getlineAllowEsc(resp)) { cancelFlow = true; break; }
                             trim_inplace(resp);
@@ -1725,9 +6052,8 @@ int main(int argc, char **argv) {
                                 chosenDisplayCat = sanitized;
                                 break;
                             } else if (!resp.empty() && (resp[0]=='r' || resp[0]=='R')) {
-                                cout << tr(acc.settings, "prompt_category");
-                                if (!getlineAllowEsc(catInput)) { cancelFlow = true; break; }
-                                trim_inplace(catInput);
+                                cout << tr(acc.settings, Msg::prompt_category);
+                                if (!readCategoryInput(acc, catInput, Msg::prompt_category)) { cancelFlow = true; break; }
                                 if (catInput.empty()) {
                                     if (amt > 0.0) { willAutoAllocate = true; }
                                     else { chosenDisplayCat = "Other"; }
@@ -1742,13 +6068,13 @@ int main(int argc, char **argv) {
                                         if (idx >= 1 && idx <= (int)cats.size()) {
                                             chosenDisplayCat = cats[idx-1].first;
                                             retriedHandled = true;
-                                        } else cout << tr(acc.settings, "number_out_of_range") << "\n";
+                                        } else cout << tr(acc.settings, Msg::number_out_of_range) << "\n";
                                     } catch (...) {}
                                 }
                                 if (retriedHandled) break;
                                 continue;
                             } else {
-                                cout << tr(acc.settings, "please_answer_c_or_r") << "\n";
+                                cout << tr(acc.settings, Msg::please_answer_c_or_r) << "\n";
                             }
                         }
                     }
@@ -1756,25 +6082,25 @@ int main(int argc, char **argv) {
 
                 if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
-                cout << tr(acc.settings, "prompt_note");
+                cout << tr(acc.settings, Msg::prompt_note);
                 string note;
                 if (!getlineAllowEsc(note)) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
                 if (amt > 0.0 && willAutoAllocate) {
                     acc.allocateAmount(d, amt, note + " (manual income)");
-                    cout << tr(acc.settings, "added_auto_allocated") << "\n";
+                    cout << tr(acc.settings, Msg::added_auto_allocated) << "\n";
                 } else {
                     if (chosenDisplayCat.empty()) chosenDisplayCat = "Other";
                     string nkChosen = normalizeKey(sanitizeDisplayName(chosenDisplayCat));
                     if (acc.displayNames.find(nkChosen) == acc.displayNames.end()) acc.displayNames[nkChosen] = sanitizeDisplayName(chosenDisplayCat);
                     acc.addManualTransaction(d, amt, acc.displayNames[nkChosen], note);
-                    cout << tr(acc.settings, "added") << "\n";
+                    cout << tr(acc.settings, Msg::added) << "\n";
                 }
 
             } else if (choice == 2) {
                 clearScreenAndScrollbackWindows();
                 cout << "[Esc (or type 'esc') then Enter returns to main menu at any prompt]\n";
-                cout << tr(acc.settings, "schedule_type_prompt");
+                cout << tr(acc.settings, Msg::schedule_type_prompt);
                 string tline;
                 int t = 0;
                 bool cancelFlow = false;
@@ -1783,20 +6109,20 @@ int main(int argc, char **argv) {
                     trim_inplace(tline);
                     try { t = stoi(tline); } catch (...) { t = 0; }
                     if (t == 1 || t == 2) break;
-                    cout << tr(acc.settings, "unknown_option") << "\n" << tr(acc.settings, "schedule_type_prompt");
+                    cout << tr(acc.settings, Msg::unknown_option) << "\n" << tr(acc.settings, Msg::schedule_type_prompt);
                 }
                 if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
                 Schedule s;
                 if (t == 1) {
                     s.type = ScheduleType::EveryXDays;
-                    cout << tr(acc.settings, "prompt_interval_days");
+                    cout << tr(acc.settings, Msg::prompt_interval_days);
                     string p;
                     if (!getlineAllowEsc(p)) { cancelFlow = true; }
                     trim_inplace(p);
                     try { s.param = stoi(p); } catch (...) { s.param = 0; }
                     while (s.param <= 0) {
-                        cout << tr(acc.settings, "interval_must_positive") << "\n" << tr(acc.settings, "prompt_interval_days");
+                        cout << tr(acc.settings, Msg::interval_must_positive) << "\n" << tr(acc.settings, Msg::prompt_interval_days);
                         if (!getlineAllowEsc(p)) { cancelFlow = true; break; }
                         trim_inplace(p);
                         try { s.param = stoi(p); } catch (...) { s.param = 0; }
@@ -1804,13 +6130,13 @@ int main(int argc, char **argv) {
                     if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
                 } else {
                     s.type = ScheduleType::MonthlyDay;
-                    cout << tr(acc.settings, "prompt_day_of_month");
+                    cout << tr(acc.settings, Msg::prompt_day_of_month);
                     string p;
                     if (!getlineAllowEsc(p)) { cancelFlow = true; }
                     trim_inplace(p);
                     try { s.param = stoi(p); } catch (...) { s.param = 0; }
                     while (s.param < 1 || s.param > 31) {
-                        cout << tr(acc.settings, "number_out_of_range") << "\n" << tr(acc.settings, "prompt_day_of_month");
+                        cout << tr(acc.settings, Msg::number_out_of_range) << "\n" << tr(acc.settings, Msg::prompt_day_of_month);
                         if (!getlineAllowEsc(p)) { cancelFlow = true; break; }
                         trim_inplace(p);
                         try { s.param = stoi(p); } catch (...) { s.param = 0; }
@@ -1818,32 +6144,26 @@ int main(int argc, char **argv) {
                     if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
                 }
 
-                cout << tr(acc.settings, "prompt_amount_recurring");
+                cout << tr(acc.settings, Msg::prompt_amount_recurring);
                 string amtLine;
                 while (true) {
                     if (!getlineAllowEsc(amtLine)) { cancelFlow = true; break; }
                     trim_inplace(amtLine);
-                    try { s.amount = stod(amtLine); break; } catch (...) { cout << tr(acc.settings, "invalid_amount") << "\n" << tr(acc.settings, "prompt_amount_recurring"); }
+                    try { s.amount = stod(amtLine); break; } catch (...) { cout << tr(acc.settings, Msg::invalid_amount) << "\n" << tr(acc.settings, Msg::prompt_amount_recurring); }
                 }
                 if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
-                cout << tr(acc.settings, "prompt_note");
+                cout << tr(acc.settings, Msg::prompt_note);
                 if (!getlineAllowEsc(s.note)) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
-                vector<pair<string,string>> cats; // pair<display, normalized>
-                for (auto &p : acc.displayNames) cats.emplace_back(p.second.empty() ? p.first : p.second, p.first);
-                sort(cats.begin(), cats.end(), [](auto &a, auto &b){ return a.first < b.first; });
-
-                cout << tr(acc.settings, "prompt_category_info") << "\n";
-                cout << tr(acc.settings, "existing_categories") << "\n";
-                for (size_t i = 0; i < cats.size(); ++i) {
-                    cout << "  " << (i+1) << ". " << cats[i].first << "\n";
-                }
-                cout << tr(acc.settings, "prompt_category") ;
+                // pair<display, normalized>; stays valid until a category is created
+                const auto &cats = acc.categories().sorted();
+                cout << tr(acc.settings, Msg::prompt_category_info) << "\n";
+                printCategoryList(acc);
+                cout << tr(acc.settings, Msg::prompt_category) ;
 
                 string catInput;
-                if (!getlineAllowEsc(catInput)) { cout << "Cancelled. Returning to main menu.\n"; continue; }
-                trim_inplace(catInput);
+                if (!readCategoryInput(acc, catInput, Msg::prompt_category)) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
                 s.category.clear();
                 s.autoAllocate = false;
@@ -1867,7 +6187,7 @@ int main(int argc, char **argv) {
                                 s.category = cats[idx-1].first;
                                 handled = true;
                             } else {
-                                cout << tr(acc.settings, "number_out_of_range") << "\n";
+                                cout << tr(acc.settings, Msg::number_out_of_range) << "\n";
                             }
                         } catch (...) {}
                     }
@@ -1877,12 +6197,10 @@ int main(int argc, char **argv) {
                         if (acc.displayNames.find(nk) != acc.displayNames.end()) {
                             s.category = acc.displayNames[nk];
                         } else {
+                            printCategorySuggestions(acc, catInput);
                             while (true) {
-                                string promptStr = tr(acc.settings, "category_missing_prompt");
-                                size_t pos = promptStr.find("{NAME}");
-                                if (pos != string::npos) promptStr.replace(pos, 6, sanitized);
-                                cout << promptStr;
-                                string resp; if (!getline(cin, resp)) resp = "r";
+                                cout << formatMsg(acc.settings, Msg::category_missing_prompt, MsgArgs().set(Slot::NAME, sanitized));
+                                string resp; if (!readInputLine(resp)) resp = "r";
                                 trim_inplace(resp);
                                 if (!resp.empty() && (resp[0]=='c' || resp[0]=='C')) {
                                     acc.displayNames[nk] = sanitized;
@@ -1891,10 +6209,9 @@ int main(int argc, char **argv) {
                                     s.category = sanitized;
                                     break;
                                 } else if (!resp.empty() && (resp[0]=='r' || resp[0]=='R')) {
-                                    cout << tr(acc.settings, "prompt_category");
+                                    cout << tr(acc.settings, Msg::prompt_category);
 
-                                    if (!getline(cin, catInput)) catInput.clear();
-                                    trim_inplace(catInput);
+                                    readCategoryInput(acc, catInput, Msg::prompt_category, false);
                                     if (catInput.empty()) {
                                         if (s.amount > 0.0) { s.autoAllocate = true; s.category.clear(); break; }
                                         else { s.category = "Other"; break; }
@@ -1907,7 +6224,7 @@ int main(int argc, char **argv) {
                                             if (idx >= 1 && idx <= (int)cats.size()) {
                                                 s.category = cats[idx-1].first;
                                                 break;
-                                            } else cout << tr(acc.settings, "number_out_of_range") << "\n";
+                                            } else cout << tr(acc.settings, Msg::number_out_of_range) << "\n";
                                         } catch (...) {}
                                     }
                                     string sanitized2 = sanitizeDisplayName(catInput);
@@ -1917,7 +6234,7 @@ int main(int argc, char **argv) {
                                         break;
                                     }
                                 } else {
-                                    cout << tr(acc.settings, "please_answer_c_or_r") << "\n";
+                                    cout << tr(acc.settings, Msg::please_answer_c_or_r) << "\n";
                                 }
                             }
                         }
@@ -1925,13 +6242,13 @@ int main(int argc, char **argv) {
                 }
 
                 if (s.autoAllocate && s.amount < 0.0) {
-                    cout << tr(acc.settings, "auto_allocate_note") << "\n";
+                    cout << tr(acc.settings, Msg::auto_allocate_note) << "\n";
 
                     if (s.category.empty()) s.category = "Other";
                     s.autoAllocate = false;
                 }
 
-                cout << tr(acc.settings, "prompt_date");
+                cout << tr(acc.settings, Msg::prompt_date);
 
                 string start;
                 while (true) {
@@ -1939,12 +6256,12 @@ int main(int argc, char **argv) {
                     trim_inplace(start);
                     if (start.empty()) { s.nextDate = today(); break; }
                     if (tryParseDate(start, s.nextDate)) break;
-                    cout << tr(acc.settings, "invalid_date_format") << "\n" << tr(acc.settings, "prompt_date");
+                    cout << tr(acc.settings, Msg::invalid_date_format) << "\n" << tr(acc.settings, Msg::prompt_date);
                 }
                 if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
 
                 acc.addSchedule(s);
-                cout << tr(acc.settings, "scheduled_added") << "\n";
+                cout << tr(acc.settings, Msg::scheduled_added) << "\n";
 
             } else if (choice == 3) {
                 clearScreenAndScrollbackWindows();
@@ -1958,30 +6275,25 @@ int main(int argc, char **argv) {
             } else if (choice == 5) {
                 clearScreenAndScrollbackWindows();
                 acc.processSchedulesUpTo(today());
-                cout << tr(acc.settings, "processed_schedules") << "\n";
+                cout << tr(acc.settings, Msg::processed_schedules) << "\n";
 
             } else if (choice == 6) {
                 // New flow: let user choose to (A)dd/Update interest entry, (R)emove, or (P)lay now apply interest up to today
                 clearScreenAndScrollbackWindows();
-                cout << tr(acc.settings, "interest_menu");
+                cout << tr(acc.settings, Msg::interest_menu);
 
-                string sub; if (!getline(cin, sub)) sub = "p";
+                string sub; if (!readInputLine(sub)) sub = "p";
                 trim_inplace(sub);
                 if (!sub.empty() && (sub[0]=='a' || sub[0]=='A')) {
                     // Add or update interest entries for one or more categories
                     // List categories:
-                    vector<pair<string,string>> cats; // display, normalized
-                    for (auto &p : acc.displayNames) cats.emplace_back(p.second.empty() ? p.first : p.second, p.first);
-                    sort(cats.begin(), cats.end(), [](auto &a, auto &b){ return a.first < b.first; });
-                    cout << tr(acc.settings, "existing_categories") << "\n";
-                    for (size_t i = 0; i < cats.size(); ++i) {
-                        cout << "  " << (i+1) << ". " << cats[i].first << "\n";
-                    }
-                    cout << tr(acc.settings, "prompt_interest_categories");
+                    const auto &cats = acc.categories().sorted(); // display, normalized
+                    printCategoryList(acc);
+                    cout << tr(acc.settings, Msg::prompt_interest_categories);
 
-                    string catSel; if (!getline(cin, catSel)) catSel.clear();
-                    trim_inplace(catSel);
-                    if (catSel.empty()) { cout << tr(acc.settings, "no_categories_selected") << "\n"; if (!askReturnToMenuOrSave(acc)) break; else continue; }
+                    string catSel;
+                    readCategoryInput(acc, catSel, Msg::prompt_interest_categories, false);
+                    if (catSel.empty()) { cout << tr(acc.settings, Msg::no_categories_selected) << "\n"; if (!askReturnToMenuOrSave(acc)) break; else continue; }
                     // split on commas
                     vector<string> selections;
                     {
@@ -2005,7 +6317,7 @@ int main(int argc, char **argv) {
                                     targets.push_back(cats[idx-1].second);
                                     continue;
                                 } else {
-                                    cout << tr(acc.settings, "selection_out_of_range") << s << "\n";
+                                    cout << tr(acc.settings, Msg::selection_out_of_range) << s << "\n";
 
                                     continue;
                                 }
@@ -2017,21 +6329,22 @@ int main(int argc, char **argv) {
                                 targets.push_back(nk);
                                 continue;
                             } else {
-                                cout << tr(acc.settings, "category_not_found_ignored") << s << " (-> " << sanitized << "). " << "\n";
+                                cout << tr(acc.settings, Msg::category_not_found_ignored) << s << " (-> " << sanitized << "). " << "\n";
+                                printCategorySuggestions(acc, s);
 
                                 continue;
                             }
                         }
                     }
-                    if (targets.empty()) { cout << tr(acc.settings, "no_valid_categories_selected") << "\n"; if (!askReturnToMenuOrSave(acc)) break; else continue; }
+                    if (targets.empty()) { cout << tr(acc.settings, Msg::no_valid_categories_selected) << "\n"; if (!askReturnToMenuOrSave(acc)) break; else continue; }
 
                     // Ask monthly or annual — require 'm' or 'a' (blank = default monthly)
                     bool monthly = true;
                     while (true) {
-                        cout << tr(acc.settings, "monthly_or_annual_prompt");
+                        cout << tr(acc.settings, Msg::monthly_or_annual_prompt);
 
                         string ma;
-                        if (!getline(cin, ma)) ma.clear();
+                        if (!readInputLine(ma)) ma.clear();
                         trim_inplace(ma);
 
                         if (ma.empty()) { // default to monthly on empty input
@@ -2043,28 +6356,28 @@ int main(int argc, char **argv) {
                         if (c == 'a' || c == 'A') { monthly = false; break; }
 
                         // invalid input — prompt again
-                        cout << tr(acc.settings, "invalid_choice_m_or_a") << "\n";
+                        cout << tr(acc.settings, Msg::invalid_choice_m_or_a) << "\n";
                         // loop back to ask again
                     }
                     // Ask for rate value
-                    cout << tr(acc.settings, "prompt_interest_rate");
+                    cout << tr(acc.settings, Msg::prompt_interest_rate);
 
-                    string rateIn; if (!getline(cin, rateIn)) rateIn.clear();
+                    string rateIn; if (!readInputLine(rateIn)) rateIn.clear();
                     trim_inplace(rateIn);
                     double ratePct = 0.0;
                     if (!tryParseRate(rateIn, ratePct)) {
-                        cout << tr(acc.settings, "invalid_rate_input") << "\n";
+                        cout << tr(acc.settings, Msg::invalid_rate_input) << "\n";
                         if (!askReturnToMenuOrSave(acc)) break; else continue;
                     }
                     // Ask for start date
-                    cout << tr(acc.settings, "prompt_date");
+                    cout << tr(acc.settings, Msg::prompt_date);
 
-                    string startIn; if (!getline(cin, startIn)) startIn.clear();
+                    string startIn; if (!readInputLine(startIn)) startIn.clear();
                     trim_inplace(startIn);
                     chrono_tp startDate = today();
                     if (!startIn.empty()) {
                         if (!tryParseDate(startIn, startDate)) {
-                            cout << tr(acc.settings, "invalid_date_format") << "\n";
+                            cout << tr(acc.settings, Msg::invalid_date_format) << "\n";
                             if (!askReturnToMenuOrSave(acc)) break; else continue;
                         }
                     }
@@ -2084,22 +6397,17 @@ int main(int argc, char **argv) {
                         ie.startDate = startDate;
                         ie.lastAppliedDate = startDate; // no prior application
                         acc.interestMap[nk] = ie;
-                        {
-                            string s = tr(acc.settings, "interest_set_for");
-                            string freq = monthly ? tr(acc.settings, "monthly") : tr(acc.settings, "annual");
-                            size_t p;
-                            if ((p = s.find("{FREQ}")) != string::npos) s.replace(p, 6, freq);
-                            if ((p = s.find("{RATE}")) != string::npos) s.replace(p, 6, to_string(ratePct));
-                            if ((p = s.find("{NAME}")) != string::npos) s.replace(p, 6, acc.displayNames[nk]);
-                            if ((p = s.find("{DATE}")) != string::npos) s.replace(p, 6, toDateString(startDate));
-                            cout << s << "\n";
-                        }
+                        cout << formatMsg(acc.settings, Msg::interest_set_for, MsgArgs()
+                                              .set(Slot::FREQ, tr(acc.settings, monthly ? Msg::monthly : Msg::annual))
+                                              .set(Slot::RATE, ratePct, 6)
+                                              .set(Slot::NAME, acc.displayNames[nk])
+                                              .set(Slot::DATE, toDateString(startDate))) << "\n";
 
                     }
                 } else if (!sub.empty() && (sub[0]=='r' || sub[0]=='R')) {
                     // remove interest entries
-                    if (acc.interestMap.empty()) { cout << tr(acc.settings, "no_interest_entries") << "\n"; if (!askReturnToMenuOrSave(acc)) break; else continue; }
-                    cout << tr(acc.settings, "interest_entries") << "\n";
+                    if (acc.interestMap.empty()) { cout << tr(acc.settings, Msg::no_interest_entries) << "\n"; if (!askReturnToMenuOrSave(acc)) break; else continue; }
+                    cout << tr(acc.settings, Msg::interest_entries) << "\n";
                     vector<pair<int,string>> idxToNk;
                     int i = 1;
                     for (auto &kv : acc.interestMap) {
@@ -2108,11 +6416,11 @@ int main(int argc, char **argv) {
                         idxToNk.push_back({i, kv.first});
                         ++i;
                     }
-                    cout << tr(acc.settings, "enter_numbers_to_remove");
+                    cout << tr(acc.settings, Msg::enter_numbers_to_remove);
 
-                    string rem; if (!getline(cin, rem)) rem.clear();
+                    string rem; if (!readInputLine(rem)) rem.clear();
                     trim_inplace(rem);
-                    if (rem.empty()) { cout << tr(acc.settings, "no_selection_made") << "\n"; if (!askReturnToMenuOrSave(acc)) break; else continue; }
+                    if (rem.empty()) { cout << tr(acc.settings, Msg::no_selection_made) << "\n"; if (!askReturnToMenuOrSave(acc)) break; else continue; }
                     vector<string> tokens;
                     string tmp;
                     for (char c : rem) {
@@ -2126,11 +6434,8 @@ int main(int argc, char **argv) {
                             for (auto &p : idxToNk) if (p.first == idx) {
                                 acc.interestMap.erase(p.second);
                                 {
-                                    string sMsg = tr(acc.settings, "interest_removed_for");
-                                    size_t pos = sMsg.find("{NAME}");
-                                    string name = (acc.displayNames.count(p.second) ? acc.displayNames[p.second] : p.second);
-                                    if (pos != string::npos) sMsg.replace(pos, 6, name);
-                                    cout << sMsg << "\n";
+                                    const string &name = (acc.displayNames.count(p.second) ? acc.displayNames[p.second] : p.second);
+                                    cout << formatMsg(acc.settings, Msg::interest_removed_for, MsgArgs().set(Slot::NAME, name)) << "\n";
                                 }
 
                             }
@@ -2138,53 +6443,119 @@ int main(int argc, char **argv) {
                     }
                 } else {
                     // process / apply interest now
-                    {
-                        string s = tr(acc.settings, "interest_processing");
-                        size_t p = s.find("{DATE}");
-                        if (p != string::npos) s.replace(p, 6, toDateString(today()));
-                        cout << s << "\n";
-                    }
+                    cout << formatMsg(acc.settings, Msg::interest_processing, MsgArgs().set(Slot::DATE, toDateString(today()))) << "\n";
 
                     acc.applyInterestUpTo(today());
-                    cout << tr(acc.settings, "interest_applied") << "\n";
+                    cout << tr(acc.settings, Msg::interest_applied) << "\n";
                 }
 
             } else if (choice == 7) {
+                // Serialize on the background writer; short saves still report inline
                 clearScreenAndScrollbackWindows();
-                acc.saveToFile();
+                saver.saveAsync(acc.snapshot());
+                if (saver.waitIdle(chrono::milliseconds(250))) {
+                    for (auto &n : saver.takeNotices()) if (n.ok) cout << tr(acc.settings, Msg::saved_to) << n.file << "\n";
+                } else {
+                    cout << tr(acc.settings, Msg::saving_in_background) << "\n";
+                }
 
             } else if (choice == 8) {
                 clearScreenAndScrollbackWindows();
-                bool ok = acc.loadFromFile();
+                bool ok = true;
+                {
+                    SaveFileLock fileLock(defaultSavePath());
+                    if (acc.fileSync.path == defaultSavePath() && !acc.hasUnsavedChangesLocked()) {
+                        // Nothing to discard: only read what changed since our last load/save
+                        auto change = acc.mergeExternalChangesLocked(defaultSavePath(), false);
+                        if (!printExternalChange(acc, change)) cout << tr(acc.settings, Msg::load_up_to_date) << "\n";
+                    } else {
+                        ok = acc.loadFromFileLocked(defaultSavePath());
+                    }
+                }
                 if (!ok) {
-                    cout << tr(acc.settings, "cannot_open_load");
+                    cout << tr(acc.settings, Msg::cannot_open_load);
                 } else {
                     // If loaded and auto-process setting is enabled, run it now
                     if (acc.settings.autoProcessOnStartup) {
-                        cout << tr(acc.settings, "auto_processing_start") << "\n";
+                        cout << tr(acc.settings, Msg::auto_processing_start) << "\n";
 
                         acc.processSchedulesUpTo(today());
                         acc.applyInterestUpTo(today());
-                        cout << tr(acc.settings, "auto_processing_done") << "\n";
+                        cout << tr(acc.settings, Msg::auto_processing_done) << "\n";
 
                     }
                 }
 
             } else if (choice == 9) {
                 clearScreenAndScrollbackWindows();
-                cout << tr(acc.settings, "goodbye") << "\n";
+                cout << tr(acc.settings, Msg::goodbye) << "\n";
                 didExit = true;
             } else if (choice == 10) {
                 // Enter settings. settingsMenu uses getline internally so no extra newline issues.
                 // (settingsMenu already has clearScreenAndScrollbackWindows at its start)
-                settingsMenu(acc);
+                if (settingsMenu(acc)) {
+                    // Nuke confirmed: stop the writer without its final flush (it may
+                    // need accMutex), then delete and leave through the normal return
+                    // so the --trace dump runs with no other thread recording
+                    accGuard.unlock();
+                    saver.discard();
+                    accGuard.lock();
+                    nukeAccount(acc);
+                    return 0;
+                }
+            } else if (choice == 11) {
+                // --- Quick entry: one transaction per line, pasted blocks are read in one go ---
+                clearScreenAndScrollbackWindows();
+                cout << "[Esc (or type 'esc') then Enter returns to main menu at any prompt]\n";
+                cout << tr(acc.settings, Msg::quick_entry_intro) << "\n";
+                const chrono_tp todayDate = today();
+                vector<QuickEntry> entries;
+                vector<pair<int,string>> errors; // line number -> parse error
+                bool cancelFlow = false;
+                int lineNo = 0;
+                string line;
+                while (true) {
+                    if (!getlineAllowEsc(line)) { cancelFlow = true; break; }
+                    trim_inplace(line);
+                    if (line.empty()) break;
+                    ++lineNo;
+                    if (line[0] == '#') continue;
+                    QuickEntry e;
+                    string err;
+                    if (parseQuickEntryLine(line, todayDate, e, err)) entries.push_back(std::move(e));
+                    else errors.emplace_back(lineNo, err);
+                }
+                if (cancelFlow) { cout << "Cancelled. Returning to main menu.\n"; continue; }
+
+                const size_t maxShown = 20;
+                for (size_t i = 0; i < errors.size() && i < maxShown; ++i) {
+                    cout << formatMsg(acc.settings, Msg::quick_entry_line_error, MsgArgs().set(Slot::LINE, errors[i].first))
+                         << errors[i].second << "\n";
+                }
+                if (errors.size() > maxShown) cout << "... (" << (errors.size() - maxShown) << " more)\n";
+
+                bool commit = !entries.empty();
+                if (commit && !errors.empty()) {
+                    cout << formatMsg(acc.settings, Msg::quick_entry_confirm_partial, MsgArgs().set(Slot::COUNT, entries.size()));
+                    string resp;
+                    if (!getlineAllowEsc(resp)) resp.clear();
+                    trim_inplace(resp);
+                    commit = !resp.empty() && (resp[0] == 'y' || resp[0] == 'Y');
+                }
+                if (commit) {
+                    acc.addTransactionsBatch(entries);
+                    cout << formatMsg(acc.settings, Msg::quick_entry_added, MsgArgs().set(Slot::COUNT, entries.size())) << "\n";
+                } else {
+                    cout << tr(acc.settings, Msg::quick_entry_nothing_added) << "\n";
+                }
             } else {
-                cout << tr(acc.settings, "invalid_choice") << "\n";
+                cout << tr(acc.settings, Msg::invalid_choice) << "\n";
             }
 
-            if (acc.settings.autoSave) {
-                // auto-save after each action if enabled
-                acc.saveToFile();
+            // (menu 7 needs no mark: its snapshot already covers pending changes)
+            if (acc.settings.autoSave && choice != 3 && choice != 7 && choice != 9) {
+                // auto-save: queue the change for the background writer
+                saver.markDirty();
             }
 
             if (didExit) break;
@@ -2195,3 +6566,4 @@ int main(int argc, char **argv) {
 
     return 0;
 }
+#endif // FINANCE_NO_MAIN